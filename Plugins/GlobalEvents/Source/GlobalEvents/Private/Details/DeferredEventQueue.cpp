@@ -0,0 +1,140 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "Details/DeferredEventQueue.h"
+#include "GlobalEventsStats.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            void FDeferredEventQueue::Push(EGlobalEventPriority InPriority, FDispatchFunction InDispatch, TUniquePtr<IEventPayload>&& InPayload)
+            {
+                check((int32)InPriority < NumPriorities);
+
+                FDeferredEvent& Event = Queues[(int32)InPriority].Events.AddDefaulted_GetRef();
+                Event.Dispatch = InDispatch;
+                Event.Payload = MoveTemp(InPayload);
+                Event.DeferTime = FPlatformTime::Seconds();
+
+                ++NumEvents;
+
+                SET_DWORD_STAT(STAT_GlobalEvents_DeferredQueueDepth, NumEvents);
+            }
+
+            double FDeferredEventQueue::DispatchFront(void* InContext, FPriorityQueue& InQueue, double InNow)
+            {
+                // move the event out, the observers may defer others and grow the array
+                FDeferredEvent Event = MoveTemp(InQueue.Events[InQueue.Head++]);
+                --NumEvents;
+
+                if (InQueue.IsEmpty())
+                {
+                    InQueue.Events.Reset();
+                    InQueue.Head = 0;
+                }
+                else if (InQueue.Head * 2 >= InQueue.Events.Num())
+                {
+                    // amortized O(1), the live half is moved once for every dispatched half
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+                    InQueue.Events.RemoveAt(0, InQueue.Head, EAllowShrinking::No);
+#else
+                    InQueue.Events.RemoveAt(0, InQueue.Head, false);
+#endif
+                    InQueue.Head = 0;
+                }
+
+                Event.Dispatch(InContext, const_cast<void*>(Event.Payload->Get()));
+
+                return InNow - Event.DeferTime;
+            }
+
+            int32 FDeferredEventQueue::Drain(void* InContext, double InBudgetSeconds, const double(&InMaxLatencySeconds)[NumPriorities])
+            {
+                SCOPE_CYCLE_COUNTER(STAT_GlobalEvents_DeferredDrain);
+
+                const double StartTime = FPlatformTime::Seconds();
+
+                int32 NumDispatched = 0;
+                int32 NumOverdue = 0;
+                double MaxLatency = 0.0;
+
+                // overdue events first, they are dispatched even when the budget is used up
+                // events deferred meanwhile are newer than StartTime, so this always ends
+                for (int32 Priority = 0; Priority < NumPriorities; ++Priority)
+                {
+                    FPriorityQueue& Queue = Queues[Priority];
+
+                    while (!Queue.IsEmpty() && StartTime - Queue.Events[Queue.Head].DeferTime >= InMaxLatencySeconds[Priority])
+                    {
+                        MaxLatency = FMath::Max(MaxLatency, DispatchFront(InContext, Queue, StartTime));
+
+                        ++NumDispatched;
+                        ++NumOverdue;
+                    }
+                }
+
+                double Now = FPlatformTime::Seconds();
+
+                for (int32 Priority = 0; Priority < NumPriorities; ++Priority)
+                {
+                    FPriorityQueue& Queue = Queues[Priority];
+
+                    while (!Queue.IsEmpty() && Now - StartTime < InBudgetSeconds)
+                    {
+                        MaxLatency = FMath::Max(MaxLatency, DispatchFront(InContext, Queue, Now));
+
+                        ++NumDispatched;
+
+                        Now = FPlatformTime::Seconds();
+                    }
+                }
+
+                SET_DWORD_STAT(STAT_GlobalEvents_DeferredQueueDepth, NumEvents);
+                SET_FLOAT_STAT(STAT_GlobalEvents_DeferredBudgetUsed, (Now - StartTime) * 1000.0);
+                SET_FLOAT_STAT(STAT_GlobalEvents_DeferredMaxLatency, MaxLatency * 1000.0);
+                INC_DWORD_STAT_BY(STAT_GlobalEvents_DeferredOverdue, NumOverdue);
+
+                return NumDispatched;
+            }
+
+            void FDeferredEventQueue::Discard()
+            {
+                for (FPriorityQueue& Queue : Queues)
+                {
+                    Queue.Events.Empty();
+                    Queue.Head = 0;
+                }
+
+                NumEvents = 0;
+
+                SET_DWORD_STAT(STAT_GlobalEvents_DeferredQueueDepth, 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "Details/DynamicTupleLayout.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            namespace
+            {
+                struct FDynamicTupleLayoutCache
+                {
+                    FRWLock                                             Lock;
+
+                    // signature id -> layout, never removed so pointers handed out stay valid
+                    TMap<int32, TUniquePtr<FDynamicTupleLayout>>        Layouts;
+                    TMap<FName, const FDynamicTupleLayout*>             CallSites;
+                };
+
+                FDynamicTupleLayoutCache& GetLayoutCache()
+                {
+                    static FDynamicTupleLayoutCache Z_Cache;
+                    return Z_Cache;
+                }
+            }
+
+            const FDynamicTupleLayout* FDynamicTupleLayout::FindOrAdd(const ISignature* InSignature, const FDynamicTupleLayout& InLayout)
+            {
+                check(InSignature != nullptr);
+
+                FDynamicTupleLayoutCache& Cache = GetLayoutCache();
+
+                const int32 SignatureId = InSignature->GetId();
+
+                {
+                    FRWScopeLock ScopeLock(Cache.Lock, SLT_ReadOnly);
+
+                    if (const TUniquePtr<FDynamicTupleLayout>* LayoutPtr = Cache.Layouts.Find(SignatureId))
+                    {
+                        return LayoutPtr->Get();
+                    }
+                }
+
+                FRWScopeLock ScopeLock(Cache.Lock, SLT_Write);
+
+                TUniquePtr<FDynamicTupleLayout>& Layout = Cache.Layouts.FindOrAdd(SignatureId);
+
+                if (!Layout.IsValid())
+                {
+                    Layout = MakeUnique<FDynamicTupleLayout>(InLayout);
+                }
+
+                return Layout.Get();
+            }
+
+            const FDynamicTupleLayout* FDynamicTupleLayout::FindCallSite(const FName& InCallSite)
+            {
+                FDynamicTupleLayoutCache& Cache = GetLayoutCache();
+
+                FRWScopeLock ScopeLock(Cache.Lock, SLT_ReadOnly);
+
+                const FDynamicTupleLayout* const* LayoutPtr = Cache.CallSites.Find(InCallSite);
+
+                return LayoutPtr != nullptr ? *LayoutPtr : nullptr;
+            }
+
+            void FDynamicTupleLayout::SetCallSite(const FName& InCallSite, const FDynamicTupleLayout* InLayout)
+            {
+                check(InLayout != nullptr);
+
+                FDynamicTupleLayoutCache& Cache = GetLayoutCache();
+
+                FRWScopeLock ScopeLock(Cache.Lock, SLT_Write);
+
+                Cache.CallSites.Add(InCallSite, InLayout);
+            }
+        }
+    }
+}
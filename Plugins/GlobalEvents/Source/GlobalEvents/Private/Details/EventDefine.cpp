@@ -0,0 +1,78 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "Details/EventDefine.h"
+#include "Misc/ScopeLock.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            namespace
+            {
+                struct FTypeSafeEventRegistryData
+                {
+                    FCriticalSection        Lock;
+                    TMap<FName, int32>      EventIds;
+                };
+
+                // events are registered during static initialization, so don't depend on the order of globals
+                FTypeSafeEventRegistryData& GetRegistryData()
+                {
+                    static FTypeSafeEventRegistryData Z_Data;
+                    return Z_Data;
+                }
+            }
+
+            int32 FTypeSafeEventRegistry::RegisterEvent(const FName& InEventName)
+            {
+                FTypeSafeEventRegistryData& Data = GetRegistryData();
+
+                FScopeLock ScopeLock(&Data.Lock);
+
+                if (const int32* IdPtr = Data.EventIds.Find(InEventName))
+                {
+                    return *IdPtr;
+                }
+
+                const int32 Id = Data.EventIds.Num();
+                Data.EventIds.Add(InEventName, Id);
+
+                return Id;
+            }
+
+            int32 FTypeSafeEventRegistry::Num()
+            {
+                FTypeSafeEventRegistryData& Data = GetRegistryData();
+
+                FScopeLock ScopeLock(&Data.Lock);
+
+                return Data.EventIds.Num();
+            }
+        }
+    }
+}
@@ -0,0 +1,170 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "Details/EventObserverAffinity.h"
+#include "Details/EventObserverSlab.h"
+#include "Async/Async.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            FEventObserverAffinity::FEventObserverAffinity(IEventObserver* InObserver, const FGlobalEventObserverOptions& InOptions) :
+                Observer(InObserver),
+                Thread(InOptions.Thread)
+#if ENGINE_MAJOR_VERSION >= 5
+                , Pipe(InOptions.Pipe)
+#endif
+            {
+                check(Observer != nullptr);
+
+#if ENGINE_MAJOR_VERSION >= 5
+                checkf(Thread != EGlobalEventThread::Pipe || Pipe != nullptr, TEXT("Observers bound to a pipe need FGlobalEventObserverOptions::Pipe."));
+#else
+                checkf(Thread != EGlobalEventThread::Pipe, TEXT("Task pipes need UE5."));
+#endif
+            }
+
+            FEventObserverAffinity::~FEventObserverAffinity()
+            {
+                FEventObserverSlab::FreeStandalone(Observer);
+            }
+
+            void FEventObserverAffinity::AddRef()
+            {
+                RefCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void FEventObserverAffinity::Release()
+            {
+                if (RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    delete this;
+                }
+            }
+
+            bool FEventObserverAffinity::IsInContext() const
+            {
+                switch (Thread)
+                {
+                case EGlobalEventThread::GameThread:
+                    return IsInGameThread();
+                case EGlobalEventThread::RenderThread:
+                    // also true on the game thread when rendering is not threaded
+                    return IsInRenderingThread();
+#if ENGINE_MAJOR_VERSION >= 5
+                case EGlobalEventThread::Pipe:
+                    return Pipe->IsInContext();
+#endif
+                default:
+                    return true;
+                }
+            }
+
+            bool FEventObserverAffinity::IsSameTarget(const FEventObserverAffinity& InOther) const
+            {
+#if ENGINE_MAJOR_VERSION >= 5
+                return Thread == InOther.Thread && Pipe == InOther.Pipe;
+#else
+                return Thread == InOther.Thread;
+#endif
+            }
+
+            void FEventObserverAffinity::Post(TUniqueFunction<void()>&& InTask) const
+            {
+                switch (Thread)
+                {
+                case EGlobalEventThread::GameThread:
+                    AsyncTask(ENamedThreads::GameThread, MoveTemp(InTask));
+                    break;
+                case EGlobalEventThread::RenderThread:
+                    // the named render thread queue, so the core module doesn't depend on RenderCore
+                    AsyncTask(ENamedThreads::GetRenderThread(), MoveTemp(InTask));
+                    break;
+#if ENGINE_MAJOR_VERSION >= 5
+                case EGlobalEventThread::Pipe:
+                    Pipe->Launch(TEXT("GlobalEventsDelivery"), MoveTemp(InTask));
+                    break;
+#endif
+                default:
+                    checkNoEntry();
+                    break;
+                }
+            }
+
+            void FEventObserverAffinity::Deliver(FDeferredList& InDeferred, TFunctionRef<TUniquePtr<IEventPayload>()> InMakePayload)
+            {
+                // group the observers by target, the dispatch order is kept inside a group
+                InDeferred.StableSort([](const FEventObserverAffinity& InA, const FEventObserverAffinity& InB)
+                    {
+#if ENGINE_MAJOR_VERSION >= 5
+                        if (InA.Thread == InB.Thread)
+                        {
+                            return (UPTRINT)InA.Pipe < (UPTRINT)InB.Pipe;
+                        }
+#endif
+                        return InA.Thread < InB.Thread;
+                    }
+                );
+
+                for (int32 Begin = 0; Begin < InDeferred.Num();)
+                {
+                    int32 End = Begin + 1;
+
+                    while (End < InDeferred.Num() && InDeferred[End]->IsSameTarget(*InDeferred[Begin]))
+                    {
+                        ++End;
+                    }
+
+                    TArray<FEventObserverAffinity*> Targets(InDeferred.GetData() + Begin, End - Begin);
+
+                    for (FEventObserverAffinity* Target : Targets)
+                    {
+                        Target->AddRef();
+                    }
+
+                    InDeferred[Begin]->Post([Targets = MoveTemp(Targets), Payload = InMakePayload()]()
+                        {
+                            for (FEventObserverAffinity* Target : Targets)
+                            {
+                                if (Target->bConnected.load(std::memory_order_relaxed))
+                                {
+                                    Target->Observer->ExecuteInvoke(Payload->Get());
+                                }
+
+                                Target->Release();
+                            }
+                        }
+                    );
+
+                    Begin = End;
+                }
+            }
+        }
+    }
+}
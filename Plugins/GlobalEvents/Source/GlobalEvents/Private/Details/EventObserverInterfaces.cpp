@@ -41,19 +41,19 @@ namespace UE
             {
             }
 
-            bool FBaseEventObserver::IsPendingDestroy() const
+            bool FBaseEventObserver::IsGeneric() const
             {
-                return bPendingDestroy;
+                return false;
             }
 
-            void FBaseEventObserver::SetPendingDestroy(bool bIsPendingDestroy)
+            FEventObserverThunk FBaseEventObserver::GetInvokeThunk() const
             {
-                bPendingDestroy = bIsPendingDestroy;
+                return nullptr;
             }
 
-            bool FBaseEventObserver::IsGeneric() const
+            FEventObserverThunk FBaseEventObserver::GetConsumeThunk() const
             {
-                return false;
+                return nullptr;
             }
 
             FDelegateHandle FBaseEventObserver::GetHandle() const
@@ -65,6 +65,11 @@ namespace UE
             {
                 return InOther != nullptr && GetType() == InOther->GetType();
             }
+
+            bool FBaseEventObserver::GetIdentityHash(uint32& OutHash) const
+            {
+                return false;
+            }
         }
     }
 }
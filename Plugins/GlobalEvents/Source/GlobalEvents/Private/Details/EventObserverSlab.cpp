@@ -0,0 +1,143 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "Details/EventObserverSlab.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            FEventObserverSlab::FEventObserverSlab()
+            {
+            }
+
+            FEventObserverSlab::FEventObserverSlab(FEventObserverSlab&& InOther) :
+                Chunks(MoveTemp(InOther.Chunks)),
+                FreeSlots(MoveTemp(InOther.FreeSlots)),
+                NumUsedSlots(InOther.NumUsedSlots)
+            {
+                InOther.NumUsedSlots = 0;
+            }
+
+            FEventObserverSlab::~FEventObserverSlab()
+            {
+                Empty();
+            }
+
+            IEventObserver* FEventObserverSlab::Allocate(IEventObserver* InSource, int32& OutSlotIndex)
+            {
+                check(InSource != nullptr);
+
+                const SIZE_T ObjectSize = InSource->GetObjectSize();
+                const SIZE_T ObjectAlignment = InSource->GetObjectAlignment();
+
+                if (ObjectSize > SlotSize || ObjectAlignment > SlotAlignment)
+                {
+                    OutSlotIndex = INDEX_NONE;
+
+                    return AllocateStandalone(InSource);
+                }
+
+                if (FreeSlots.Num() > 0)
+                {
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+                    OutSlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+#else
+                    OutSlotIndex = FreeSlots.Pop(false);
+#endif
+                }
+                else
+                {
+                    if (NumUsedSlots == Chunks.Num() * SlotsPerChunk)
+                    {
+                        Chunks.Add((uint8*)FMemory::Malloc(SlotSize * SlotsPerChunk, SlotAlignment));
+                    }
+
+                    OutSlotIndex = NumUsedSlots++;
+                }
+
+                return InSource->CloneAndMove(GetSlotAddress(OutSlotIndex));
+            }
+
+            void FEventObserverSlab::Free(IEventObserver* InInstance, int32 InSlotIndex)
+            {
+                check(InInstance != nullptr);
+
+                if (InSlotIndex == INDEX_NONE)
+                {
+                    FreeStandalone(InInstance);
+                }
+                else
+                {
+                    checkSlow(GetSlotAddress(InSlotIndex) == (void*)InInstance);
+
+                    InInstance->~IEventObserver();
+
+                    FreeSlots.Push(InSlotIndex);
+                }
+            }
+
+            IEventObserver* FEventObserverSlab::AllocateStandalone(IEventObserver* InSource)
+            {
+                check(InSource != nullptr);
+
+                return InSource->CloneAndMove(FMemory::Malloc(InSource->GetObjectSize(), InSource->GetObjectAlignment()));
+            }
+
+            void FEventObserverSlab::FreeStandalone(IEventObserver* InInstance)
+            {
+                check(InInstance != nullptr);
+
+                InInstance->~IEventObserver();
+
+                FMemory::Free(InInstance);
+            }
+
+            void FEventObserverSlab::Empty()
+            {
+                checkf(GetNumUsedSlots() == 0, TEXT("All observers must be freed before empty the slab."));
+
+                for (uint8* Chunk : Chunks)
+                {
+                    FMemory::Free(Chunk);
+                }
+
+                Chunks.Empty();
+                FreeSlots.Empty();
+                NumUsedSlots = 0;
+            }
+
+            void* FEventObserverSlab::GetSlotAddress(int32 InSlotIndex) const
+            {
+                checkSlow(InSlotIndex >= 0 && InSlotIndex < NumUsedSlots);
+
+                return Chunks[InSlotIndex / SlotsPerChunk] + (InSlotIndex % SlotsPerChunk) * SlotSize;
+            }
+        }
+    }
+}
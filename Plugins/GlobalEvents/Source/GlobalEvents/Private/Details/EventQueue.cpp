@@ -0,0 +1,245 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "Details/EventQueue.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            static_assert(sizeof(std::atomic<uint32>) + sizeof(uint32) <= 16, "Arena block header doesn't fit in BlockHeaderSize.");
+
+            FEventQueue::FEventQueue(int32 InArenaSize) :
+                Head(&Stub),
+                Tail(&Stub)
+            {
+                ArenaSize = Align(FMath::Max(InArenaSize, 0), (int32)BlockAlignment);
+
+                if (ArenaSize > 0)
+                {
+                    Arena = (uint8*)FMemory::Malloc(ArenaSize, BlockAlignment);
+                    FMemory::Memzero(Arena, ArenaSize);
+                }
+            }
+
+            FEventQueue::~FEventQueue()
+            {
+                Discard();
+
+                if (Arena != nullptr)
+                {
+                    FMemory::Free(Arena);
+                }
+            }
+
+            FEventQueue::FRecord* FEventQueue::AllocateRecord(SIZE_T InPayloadSize, SIZE_T InPayloadAlignment)
+            {
+                const SIZE_T PayloadOffset = Align(sizeof(FRecord), InPayloadAlignment);
+                const SIZE_T RecordSize = PayloadOffset + InPayloadSize;
+                const uint64 BlockSize = Align(BlockHeaderSize + RecordSize, BlockAlignment);
+
+                // big payloads would make the arena wrap around too often, they go to the heap
+                if (Arena != nullptr && InPayloadAlignment <= BlockAlignment && BlockSize <= (uint64)ArenaSize / 4)
+                {
+                    uint64 WriteOffset = ArenaWriteOffset.load(std::memory_order_relaxed);
+
+                    for (;;)
+                    {
+                        const uint64 Position = WriteOffset % ArenaSize;
+
+                        // a block never wraps around, the rest of the arena becomes padding
+                        const uint64 PaddingSize = Position + BlockSize > (uint64)ArenaSize ? ArenaSize - Position : 0;
+
+                        if (WriteOffset + PaddingSize + BlockSize - ArenaReadOffset.load(std::memory_order_acquire) > (uint64)ArenaSize)
+                        {
+                            // the arena is full until the consumer catches up
+                            break;
+                        }
+
+                        if (ArenaWriteOffset.compare_exchange_weak(WriteOffset, WriteOffset + PaddingSize + BlockSize, std::memory_order_acq_rel))
+                        {
+                            if (PaddingSize > 0)
+                            {
+                                FArenaBlock* Padding = (FArenaBlock*)(Arena + Position);
+                                Padding->Size = (uint32)PaddingSize;
+                                Padding->State.store(EArenaBlockState::Padding, std::memory_order_release);
+                            }
+
+                            // ReleaseArena stops at an empty block, so it never reads the size of a record which is not consumed yet
+                            FArenaBlock* Block = (FArenaBlock*)(Arena + (WriteOffset + PaddingSize) % ArenaSize);
+                            Block->Size = (uint32)BlockSize;
+                            Block->State.store(EArenaBlockState::Empty, std::memory_order_release);
+
+                            FRecord* Record = new ((uint8*)Block + BlockHeaderSize) FRecord();
+                            Record->PayloadOffset = (uint32)PayloadOffset;
+                            Record->bInArena = true;
+
+                            return Record;
+                        }
+                    }
+                }
+
+                FRecord* Record = new (FMemory::Malloc(RecordSize, FMath::Max<SIZE_T>(InPayloadAlignment, alignof(FRecord)))) FRecord();
+                Record->PayloadOffset = (uint32)PayloadOffset;
+                Record->bInArena = false;
+
+                return Record;
+            }
+
+            void FEventQueue::FreeRecord(FRecord* InRecord)
+            {
+                const bool bInArena = InRecord->bInArena;
+
+                InRecord->~FRecord();
+
+                if (!bInArena)
+                {
+                    FMemory::Free(InRecord);
+
+                    return;
+                }
+
+                FArenaBlock* Block = (FArenaBlock*)((uint8*)InRecord - BlockHeaderSize);
+                Block->State.store(EArenaBlockState::Consumed, std::memory_order_relaxed);
+
+                ReleaseArena();
+            }
+
+            void FEventQueue::ReleaseArena()
+            {
+                // records are consumed in queue order, which may differ from the arena order,
+                // so the read offset only moves over the consumed blocks at its front
+                uint64 ReadOffset = ArenaReadOffset.load(std::memory_order_relaxed);
+                const uint64 WriteOffset = ArenaWriteOffset.load(std::memory_order_acquire);
+
+                while (ReadOffset < WriteOffset)
+                {
+                    FArenaBlock* Block = (FArenaBlock*)(Arena + ReadOffset % ArenaSize);
+
+                    if (Block->State.load(std::memory_order_acquire) == EArenaBlockState::Empty)
+                    {
+                        break;
+                    }
+
+                    // the next headers may land anywhere in this block, producers must find them empty
+                    // even before they have written them, so the whole block is cleared and not only its header
+                    const uint32 BlockSize = Block->Size;
+                    checkSlow(BlockSize > 0 && BlockSize % BlockAlignment == 0 && ReadOffset % ArenaSize + BlockSize <= (uint64)ArenaSize);
+
+                    FMemory::Memzero(Block, BlockSize);
+
+                    ReadOffset += BlockSize;
+                }
+
+                ArenaReadOffset.store(ReadOffset, std::memory_order_release);
+            }
+
+            void FEventQueue::Push(FRecord* InRecord)
+            {
+                InRecord->Next.store(nullptr, std::memory_order_relaxed);
+
+                FRecord* Prev = Head.exchange(InRecord, std::memory_order_acq_rel);
+
+                // the record is invisible to the consumer until it is linked here
+                Prev->Next.store(InRecord, std::memory_order_release);
+            }
+
+            FEventQueue::FRecord* FEventQueue::Pop()
+            {
+                FRecord* Record = Tail;
+                FRecord* Next = Record->Next.load(std::memory_order_acquire);
+
+                if (Record == &Stub)
+                {
+                    if (Next == nullptr)
+                    {
+                        return nullptr;
+                    }
+
+                    Tail = Next;
+                    Record = Next;
+                    Next = Next->Next.load(std::memory_order_acquire);
+                }
+
+                if (Next != nullptr)
+                {
+                    Tail = Next;
+
+                    return Record;
+                }
+
+                // a producer has exchanged the head but not linked its record yet
+                if (Record != Head.load(std::memory_order_acquire))
+                {
+                    return nullptr;
+                }
+
+                // Record is the last one, push the stub behind it so it can be unlinked
+                Push(&Stub);
+
+                Next = Record->Next.load(std::memory_order_acquire);
+
+                if (Next != nullptr)
+                {
+                    Tail = Next;
+
+                    return Record;
+                }
+
+                return nullptr;
+            }
+
+            int32 FEventQueue::Drain(void* InContext)
+            {
+                // Head is not checked, Pop pushes the stub back while producers may still link records before it
+                int32 NumEvents = 0;
+
+                while (FRecord* Record = Pop())
+                {
+                    Record->Dispatch(InContext, Record->GetPayload());
+                    Record->Destroy(Record->GetPayload());
+
+                    FreeRecord(Record);
+
+                    ++NumEvents;
+                }
+
+                return NumEvents;
+            }
+
+            void FEventQueue::Discard()
+            {
+                while (FRecord* Record = Pop())
+                {
+                    Record->Destroy(Record->GetPayload());
+
+                    FreeRecord(Record);
+                }
+            }
+        }
+    }
+}
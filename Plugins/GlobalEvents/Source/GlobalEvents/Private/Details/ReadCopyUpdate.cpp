@@ -0,0 +1,267 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "Details/ReadCopyUpdate.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformProcess.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include <atomic>
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            namespace
+            {
+                // epoch of a reader thread, 0 when the thread is outside of any read scope
+                // records are never freed, a record is reused by another thread after its owner exits
+                struct FReaderRecord
+                {
+                    std::atomic<uint64>     Epoch{ 0 };
+                    std::atomic<bool>       bInUse{ false };
+                    FReaderRecord*          Next = nullptr;
+                };
+
+                struct FRetiredEntry
+                {
+                    uint64                  Epoch;
+                    TUniqueFunction<void()> Deleter;
+                };
+
+                struct FReadCopyUpdateData
+                {
+                    std::atomic<FReaderRecord*> Readers{ nullptr };
+                    std::atomic<uint64>         GlobalEpoch{ 1 };
+
+                    FCriticalSection            RetiredLock;
+                    TArray<FRetiredEntry>       Retired;
+                };
+
+                FReadCopyUpdateData& GetData()
+                {
+                    static FReadCopyUpdateData Z_Data;
+                    return Z_Data;
+                }
+
+                FReaderRecord* AcquireReaderRecord()
+                {
+                    FReadCopyUpdateData& Data = GetData();
+
+                    for (FReaderRecord* Record = Data.Readers.load(); Record != nullptr; Record = Record->Next)
+                    {
+                        bool bExpected = false;
+
+                        if (Record->bInUse.compare_exchange_strong(bExpected, true))
+                        {
+                            return Record;
+                        }
+                    }
+
+                    FReaderRecord* Record = new FReaderRecord();
+                    Record->bInUse.store(true);
+
+                    FReaderRecord* Head = Data.Readers.load();
+
+                    do
+                    {
+                        Record->Next = Head;
+                    } while (!Data.Readers.compare_exchange_weak(Head, Record));
+
+                    return Record;
+                }
+
+                struct FThreadReaderState
+                {
+                    FReaderRecord*  Record = nullptr;
+                    int32           Depth = 0;
+
+                    ~FThreadReaderState()
+                    {
+                        if (Record != nullptr)
+                        {
+                            Record->Epoch.store(0);
+                            Record->bInUse.store(false);
+                        }
+                    }
+                };
+
+                thread_local FThreadReaderState GThreadReaderState;
+
+                // smallest epoch of the readers inside a read scope
+                uint64 GetMinActiveEpoch()
+                {
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    uint64 MinEpoch = MAX_uint64;
+
+                    for (FReaderRecord* Record = GetData().Readers.load(); Record != nullptr; Record = Record->Next)
+                    {
+                        const uint64 Epoch = Record->Epoch.load();
+
+                        if (Epoch != 0 && Epoch < MinEpoch)
+                        {
+                            MinEpoch = Epoch;
+                        }
+                    }
+
+                    return MinEpoch;
+                }
+            }
+
+            void FReadCopyUpdate::EnterRead()
+            {
+                FThreadReaderState& State = GThreadReaderState;
+
+                if (State.Depth++ > 0)
+                {
+                    return;
+                }
+
+                if (State.Record == nullptr)
+                {
+                    State.Record = AcquireReaderRecord();
+                }
+
+                State.Record->Epoch.store(GetData().GlobalEpoch.load());
+
+                // the epoch must be visible before any published pointer is loaded
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+
+            void FReadCopyUpdate::LeaveRead()
+            {
+                FThreadReaderState& State = GThreadReaderState;
+
+                check(State.Depth > 0);
+
+                if (--State.Depth == 0)
+                {
+                    State.Record->Epoch.store(0, std::memory_order_release);
+                }
+            }
+
+            void FReadCopyUpdate::Retire(TUniqueFunction<void()>&& InDeleter)
+            {
+                FReadCopyUpdateData& Data = GetData();
+
+                {
+                    FScopeLock ScopeLock(&Data.RetiredLock);
+
+                    // readers which entered before this point may see the retired data, later readers can't
+                    Data.Retired.Add(FRetiredEntry{ Data.GlobalEpoch.fetch_add(1), MoveTemp(InDeleter) });
+                }
+
+                Reclaim();
+            }
+
+            void FReadCopyUpdate::Reclaim()
+            {
+                FReadCopyUpdateData& Data = GetData();
+
+                TArray<FRetiredEntry> Reclaimable;
+
+                {
+                    FScopeLock ScopeLock(&Data.RetiredLock);
+
+                    if (Data.Retired.Num() == 0)
+                    {
+                        return;
+                    }
+
+                    const uint64 MinActiveEpoch = GetMinActiveEpoch();
+
+                    // entries are retired in epoch order
+                    int32 NumReclaimable = 0;
+
+                    while (NumReclaimable < Data.Retired.Num() && Data.Retired[NumReclaimable].Epoch < MinActiveEpoch)
+                    {
+                        ++NumReclaimable;
+                    }
+
+                    if (NumReclaimable == 0)
+                    {
+                        return;
+                    }
+
+                    Reclaimable.Reserve(NumReclaimable);
+
+                    for (int32 i = 0; i < NumReclaimable; ++i)
+                    {
+                        Reclaimable.Add(MoveTemp(Data.Retired[i]));
+                    }
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+                    Data.Retired.RemoveAt(0, NumReclaimable, EAllowShrinking::No);
+#else
+                    Data.Retired.RemoveAt(0, NumReclaimable, false);
+#endif
+                }
+
+                // deleters may retire more data, so they are called outside of the lock
+                for (FRetiredEntry& Entry : Reclaimable)
+                {
+                    Entry.Deleter();
+                }
+            }
+
+            void FReadCopyUpdate::Synchronize()
+            {
+                checkf(GThreadReaderState.Depth == 0, TEXT("Synchronize inside a read scope never returns."));
+
+                FReadCopyUpdateData& Data = GetData();
+
+                // data retired by other writers after this point is not waited for
+                const uint64 TargetEpoch = Data.GlobalEpoch.load();
+
+                for (;;)
+                {
+                    Reclaim();
+
+                    {
+                        FScopeLock ScopeLock(&Data.RetiredLock);
+
+                        if (Data.Retired.Num() == 0 || Data.Retired[0].Epoch >= TargetEpoch)
+                        {
+                            return;
+                        }
+                    }
+
+                    FPlatformProcess::Yield();
+                }
+            }
+
+            int32 FReadCopyUpdate::GetNumRetired()
+            {
+                FReadCopyUpdateData& Data = GetData();
+
+                FScopeLock ScopeLock(&Data.RetiredLock);
+
+                return Data.Retired.Num();
+            }
+        }
+    }
+}
@@ -25,7 +25,47 @@
 */
 #include "Details/Signals.h"
 #include "Details/EventObservers.h"
+#include "DynamicTuple.h"
 #include "GlobalEventsLog.h"
+#include "GlobalEventsStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
+#include "Misc/ScopeLock.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+static int32 GGlobalEventsCompactionThreshold = 32;
+static FAutoConsoleVariableRef CVarGlobalEventsCompactionThreshold(
+    TEXT("GlobalEvents.CompactionThreshold"),
+    GGlobalEventsCompactionThreshold,
+    TEXT("Number of removed observers a signal may keep as tombstones before it compacts at the end of a dispatch.\n")
+    TEXT("Tombstones are always compacted when they are half of the signal or older than the current frame."),
+    ECVF_Default
+);
+
+static int32 GGlobalEventsMaxDispatchDepth = 32;
+static FAutoConsoleVariableRef CVarGlobalEventsMaxDispatchDepth(
+    TEXT("GlobalEvents.MaxDispatchDepth"),
+    GGlobalEventsMaxDispatchDepth,
+    TEXT("Maximum number of nested broadcasts of the same event, deeper broadcasts are dropped with a warning."),
+    ECVF_Default
+);
+
+static int32 GGlobalEventsParallelDispatchThreshold = 256;
+static FAutoConsoleVariableRef CVarGlobalEventsParallelDispatchThreshold(
+    TEXT("GlobalEvents.ParallelDispatchThreshold"),
+    GGlobalEventsParallelDispatchThreshold,
+    TEXT("Minimum number of concurrent-safe observers before a broadcast fans them out over the task graph, 0 disables parallel dispatch."),
+    ECVF_Default
+);
+
+static int32 GGlobalEventsParallelDispatchBatchSize = 64;
+static FAutoConsoleVariableRef CVarGlobalEventsParallelDispatchBatchSize(
+    TEXT("GlobalEvents.ParallelDispatchBatchSize"),
+    GGlobalEventsParallelDispatchBatchSize,
+    TEXT("Number of concurrent-safe observers called by one task of a parallel dispatch."),
+    ECVF_Default
+);
 
 namespace UE
 {
@@ -39,145 +79,644 @@ namespace UE
 
             FBaseSignal::FBaseSignal(FBaseSignal&& InSignal) :
                 Targets(MoveTemp(InSignal.Targets)),
-                LockedFlag(InSignal.LockedFlag)
+                Slab(MoveTemp(InSignal.Slab)),
+                HandleIndices(MoveTemp(InSignal.HandleIndices)),
+                IdentityHandles(MoveTemp(InSignal.IdentityHandles)),
+                NumTombstones(InSignal.NumTombstones),
+                NumConcurrentSafeTargets(InSignal.NumConcurrentSafeTargets),
+                NumObservers(InSignal.NumObservers.exchange(0)),
+                TombstoneFrame(InSignal.TombstoneFrame),
+                VerifiedInvoker(InSignal.VerifiedInvoker.load()),
+                VerifiedObserverSignature(InSignal.VerifiedObserverSignature),
+                VerifiedObserverEpoch(InSignal.VerifiedObserverEpoch),
+                DispatchDepth(InSignal.DispatchDepth),
+                PublishedObservers(InSignal.PublishedObservers.exchange(nullptr)),
+                RemovedObservers(MoveTemp(InSignal.RemovedObservers)),
+                bObserversChanged(InSignal.bObserversChanged),
+                bConcurrentDispatch(InSignal.bConcurrentDispatch)
             {
+                InSignal.NumTombstones = 0;
+                InSignal.NumConcurrentSafeTargets = 0;
+            }
+
+            FBaseSignal::~FBaseSignal()
+            {
+                checkf(DispatchDepth == 0, TEXT("Signal is destroyed during dispatch, the owner must keep it alive."));
+                checkf(RemovedObservers.Num() == 0, TEXT("Removed observers must be retired when the write ends."));
+
+                // the owner of a concurrent signal retires it, so no reader can see the snapshot anymore
+                delete PublishedObservers.exchange(nullptr);
+
+                for (const FEventObserverEntry& Entry : Targets)
+                {
+                    if (Entry.Observer != nullptr)
+                    {
+                        FreeObserver(Entry);
+                    }
+                }
+
+                Targets.Empty();
             }
 
             bool FBaseSignal::IsLocked() const
             {
-                return LockedFlag;
+                return DispatchDepth > 0;
             }
 
             bool FBaseSignal::IsEmpty() const
             {
-                return IsTargetsEmpty();
+                return Num() == 0;
             }
 
             int FBaseSignal::Num() const
             {
-                return Targets.Num();
+                return NumObservers.load(std::memory_order_relaxed);
+            }
+
+            void FBaseSignal::EnableConcurrentDispatch()
+            {
+                checkf(Targets.Num() == 0 && !IsLocked(), TEXT("Concurrent dispatch must be enabled before any observer is connected."));
+
+                bConcurrentDispatch = true;
+            }
+
+            FBaseSignal::FWriteScope::FWriteScope(FBaseSignal* InOwner) :
+                Owner(InOwner)
+            {
+                if (Owner->bConcurrentDispatch)
+                {
+                    Owner->WriterLock.Lock();
+                }
+            }
+
+            FBaseSignal::FWriteScope::~FWriteScope()
+            {
+                if (Owner->bConcurrentDispatch)
+                {
+                    if (Owner->bObserversChanged)
+                    {
+                        Owner->PublishObservers();
+                    }
+
+                    Owner->WriterLock.Unlock();
+                }
+            }
+
+            void FBaseSignal::PublishObservers()
+            {
+                check(bConcurrentDispatch);
+
+                bObserversChanged = false;
+
+                FEventObserverSnapshot* Snapshot = nullptr;
+
+                if (Targets.Num() > NumTombstones)
+                {
+                    Snapshot = new FEventObserverSnapshot();
+                    Snapshot->Entries.Reserve(Targets.Num() - NumTombstones);
+
+                    for (const FEventObserverEntry& Entry : Targets)
+                    {
+                        if (!Entry.IsPendingDestroy())
+                        {
+                            Snapshot->Entries.Add(Entry);
+                            Snapshot->NumConcurrentSafe += Entry.IsConcurrentSafe() ? 1 : 0;
+                        }
+                    }
+                }
+
+                FEventObserverSnapshot* OldSnapshot = PublishedObservers.exchange(Snapshot, std::memory_order_acq_rel);
+
+                // readers that loaded the old snapshot may still call the removed observers
+                if (OldSnapshot != nullptr || RemovedObservers.Num() > 0)
+                {
+                    FReadCopyUpdate::Retire([OldSnapshot, Entries = MoveTemp(RemovedObservers)]()
+                        {
+                            delete OldSnapshot;
+
+                            for (const FEventObserverEntry& Entry : Entries)
+                            {
+                                FreeStandaloneObserver(Entry);
+                            }
+                        }
+                    );
+
+                    RemovedObservers.Reset();
+                }
+            }
+
+            void FBaseSignal::ReleaseObserver(const FEventObserverEntry& InEntry)
+            {
+                if (InEntry.Affinity != nullptr)
+                {
+                    InEntry.Affinity->Disconnect();
+                }
+
+                if (bConcurrentDispatch)
+                {
+                    checkSlow(InEntry.SlotIndex == INDEX_NONE);
+
+                    RemovedObservers.Add(InEntry);
+                    bObserversChanged = true;
+                }
+                else
+                {
+                    FreeObserver(InEntry);
+                }
+            }
+
+            void FBaseSignal::FreeObserver(const FEventObserverEntry& InEntry)
+            {
+                if (InEntry.SlotIndex != INDEX_NONE)
+                {
+                    Slab.Free(InEntry.Observer, InEntry.SlotIndex);
+                }
+                else
+                {
+                    FreeStandaloneObserver(InEntry);
+                }
+            }
+
+            void FBaseSignal::FreeStandaloneObserver(const FEventObserverEntry& InEntry)
+            {
+                if (InEntry.Affinity != nullptr)
+                {
+                    // deliveries in flight may hold the observer, the last of them frees it
+                    InEntry.Affinity->Disconnect();
+                    InEntry.Affinity->Release();
+                }
+                else
+                {
+                    FEventObserverSlab::FreeStandalone(InEntry.Observer);
+                }
+            }
+
+            bool FBaseSignal::CheckInvokeableFromStaticSlow(const ISignature* InInvokerSignature)
+            {
+                if (!GetSignature()->CheckInvokeableFrom(InInvokerSignature))
+                {
+                    return false;
+                }
+
+                VerifiedInvoker.store(MakeVerifiedInvoker(InInvokerSignature), std::memory_order_relaxed);
+
+                return true;
+            }
+
+            bool FBaseSignal::CheckObserverCompatible(const IEventObserver* InInstance)
+            {
+                const ISignature* ObserverSignature = InInstance->GetSignature();
+
+                if (ObserverSignature == VerifiedObserverSignature && VerifiedObserverEpoch == FSignatureCompatibilityEpoch::Get())
+                {
+                    return true;
+                }
+
+                if (!ObserverSignature->CheckInvokeableFrom(GetSignature()))
+                {
+                    return false;
+                }
+
+                // only generic observers share static signatures, others are owned by the observer itself
+                if (InInstance->IsGeneric())
+                {
+                    VerifiedObserverSignature = ObserverSignature;
+                    VerifiedObserverEpoch = FSignatureCompatibilityEpoch::Get();
+                }
+
+                return true;
+            }
+
+            SIZE_T FBaseSignal::GetAllocatedSize() const
+            {
+                return Targets.GetAllocatedSize() +
+                    Slab.GetAllocatedSize() +
+                    HandleIndices.GetAllocatedSize() +
+                    IdentityHandles.GetAllocatedSize();
             }
 
             void FBaseSignal::DisconnectAll()
             {
-                if (LockedFlag)
+                FWriteScope WriteScope(this);
+
+                HandleIndices.Empty();
+                IdentityHandles.Empty();
+                NumConcurrentSafeTargets = 0;
+                NumObservers.store(0, std::memory_order_relaxed);
+
+                if (IsLocked())
                 {
-                    for (auto& Instance : Targets)
+                    for (FEventObserverEntry& Entry : Targets)
                     {
-                        Instance->SetPendingDestroy(true);
+                        Entry.Flags |= EEventObserverEntryFlags::PendingDestroy;
+
+                        if (Entry.Affinity != nullptr)
+                        {
+                            Entry.Affinity->Disconnect();
+                        }
                     }
+
+                    if (NumTombstones == 0)
+                    {
+                        TombstoneFrame = GFrameCounter;
+                    }
+
+                    NumTombstones = Targets.Num();
                 }
                 else
                 {
+                    for (const FEventObserverEntry& Entry : Targets)
+                    {
+                        if (Entry.Observer != nullptr)
+                        {
+                            ReleaseObserver(Entry);
+                        }
+                    }
+
                     Targets.Empty();
+                    NumTombstones = 0;
                 }
             }
 
             FDelegateHandle FBaseSignal::Connect(IEventObserver* InInstance)
+            {
+                return Connect(InInstance, FGlobalEventObserverOptions());
+            }
+
+            FDelegateHandle FBaseSignal::Connect(IEventObserver* InInstance, const FGlobalEventObserverOptions& InOptions)
             {
                 check(InInstance != nullptr);
 
-                if (!InInstance->GetSignature()->CheckInvokeableFrom(GetSignature()))
+                FWriteScope WriteScope(this);
+
+                if (!CheckObserverCompatible(InInstance))
                 {
                     UE_LOG(GlobalEventsLog, Warning, TEXT("Failed connect signal(%s) with delegate(%s)"), *GetSignature()->ToString(), *InInstance->GetSignature()->ToString());
 
                     return FDelegateHandle();
                 }
 
-                for (int32 i = 0; i < Targets.Num(); ++i)
-                {
-                    auto& Instance = Targets[i];
+                uint32 IdentityHash = 0;
+                const bool bHasIdentity = InInstance->GetIdentityHash(IdentityHash);
 
-                    // valid instance is already exists, so skip add new 
-                    if (!Instance->IsPendingDestroy() && Instance->EqualTo(InInstance))
-                    {
-                        return FDelegateHandle();
-                    }
+                // valid instance is already exists, so skip add new 
+                if (bHasIdentity && FindEqualTarget(InInstance, IdentityHash) != INDEX_NONE)
+                {
+                    return FDelegateHandle();
                 }
 
                 // push to ends
-                auto EventObserver = TSharedPtr<IEventObserver>((IEventObserver*)InInstance->CloneAndMove());
-                Targets.Push(EventObserver);
+                // observers of a concurrent signal are freed after a grace period on any thread, so they can't share the slab
+                // observers bound to a thread may be called by deliveries that outlive the signal, so they don't use the slab either
+                const bool bBoundToThread = InOptions.Thread != EGlobalEventThread::Any;
+
+                FEventObserverEntry Entry;
+                Entry.Observer = bConcurrentDispatch || bBoundToThread ? FEventObserverSlab::AllocateStandalone(InInstance) : Slab.Allocate(InInstance, Entry.SlotIndex);
+                Entry.Thunk = Entry.Observer->GetInvokeThunk();
+                bObserversChanged = true;
+
+                if (bBoundToThread)
+                {
+                    Entry.Affinity = new FEventObserverAffinity(Entry.Observer, InOptions);
+                }
+                else if (InOptions.bConcurrentSafe)
+                {
+                    Entry.Flags |= EEventObserverEntryFlags::ConcurrentSafe;
+                    ++NumConcurrentSafeTargets;
+                }
 
-                return EventObserver->GetHandle();
+                const FDelegateHandle Handle = Entry.Observer->GetHandle();
+                HandleIndices.Add(Handle, Targets.Add(Entry));
+                NumObservers.fetch_add(1, std::memory_order_relaxed);
+
+                if (bHasIdentity)
+                {
+                    IdentityHandles.Add(IdentityHash, Handle);
+                }
+
+                return Handle;
             }
 
             bool FBaseSignal::Disconnect(IEventObserver* InInstance)
             {
-                return DisconnectImpl([=](TSharedPtr<IEventObserver>& InstanceRef)
+                FWriteScope WriteScope(this);
+
+                uint32 IdentityHash = 0;
+
+                // observers without identity never equal to others
+                if (!InInstance->GetIdentityHash(IdentityHash))
+                {
+                    return false;
+                }
+
+                const int32 Index = FindEqualTarget(InInstance, IdentityHash);
+
+                if (Index == INDEX_NONE)
+                {
+                    return false;
+                }
+
+                RemoveTarget(Index);
+
+                return true;
+            }
+
+            int32 FBaseSignal::FindEqualTarget(const IEventObserver* InInstance, uint32 InIdentityHash) const
+            {
+                for (TMultiMap<uint32, FDelegateHandle>::TConstKeyIterator It = IdentityHandles.CreateConstKeyIterator(InIdentityHash); It; ++It)
+                {
+                    const int32 Index = HandleIndices.FindChecked(It.Value());
+
+                    if (Targets[Index].Observer->EqualTo(InInstance))
                     {
-                        return InstanceRef->EqualTo(InInstance);
-                    });
+                        return Index;
+                    }
+                }
+
+                return INDEX_NONE;
             }
 
             bool FBaseSignal::Disconnect(FDelegateHandle InHandle)
             {
-                return DisconnectImpl([=](TSharedPtr<IEventObserver>& InstanceRef)
-                    {
-                        return InstanceRef->GetHandle() == InHandle;
-                    });
+                FWriteScope WriteScope(this);
+
+                const int32* IndexPtr = HandleIndices.Find(InHandle);
+
+                if (IndexPtr == nullptr)
+                {
+                    return false;
+                }
+
+                RemoveTarget(*IndexPtr);
+
+                return true;
             }
 
-            void FBaseSignal::Lock()
+            bool FBaseSignal::Lock()
             {
-                check(!LockedFlag);
+                if (DispatchDepth >= GGlobalEventsMaxDispatchDepth)
+                {
+                    UE_LOG(GlobalEventsLog, Warning, TEXT("Broadcast is dropped, signal(%s) reached max dispatch depth %d. Is an observer raising the same event recursively?"),
+                        *GetSignature()->ToString(),
+                        DispatchDepth
+                    );
+
+                    return false;
+                }
+
+                ++DispatchDepth;
 
-                LockedFlag = true;
+                return true;
             }
 
             void FBaseSignal::UnLock()
             {
-                check(LockedFlag);
+                check(DispatchDepth > 0);
 
-                LockedFlag = false;
+                // nested dispatches may still hold pointers of removed observers,
+                // so they are only reclaimed when the outermost dispatch ends.
+                if (--DispatchDepth > 0)
+                {
+                    return;
+                }
 
-                Targets.RemoveAll(
-                    [](TSharedPtr<IEventObserver>& InPtr)
+                if (ShouldCompact())
+                {
+                    Compact();
+                }
+                else
+                {
+                    INC_DWORD_STAT(STAT_GlobalEvents_CompactionsSkipped);
+                    INC_DWORD_STAT_BY(STAT_GlobalEvents_CompactionEntriesSkipped, Targets.Num());
+                }
+            }
+
+            bool FBaseSignal::ShouldCompact() const
+            {
+                if (NumTombstones == 0)
+                {
+                    return false;
+                }
+
+                return NumTombstones >= GGlobalEventsCompactionThreshold ||
+                    NumTombstones * 2 >= Targets.Num() ||
+                    TombstoneFrame != GFrameCounter;
+            }
+
+            void FBaseSignal::RemoveTarget(int32 InIndex)
+            {
+                FEventObserverEntry& Entry = Targets[InIndex];
+
+                checkSlow(!Entry.IsPendingDestroy());
+
+                const FDelegateHandle Handle = Entry.Observer->GetHandle();
+
+                HandleIndices.Remove(Handle);
+
+                uint32 IdentityHash = 0;
+                if (Entry.Observer->GetIdentityHash(IdentityHash))
+                {
+                    IdentityHandles.RemoveSingle(IdentityHash, Handle);
+                }
+
+                Entry.Flags |= EEventObserverEntryFlags::PendingDestroy;
+                bObserversChanged = true;
+
+                if (Entry.Affinity != nullptr)
+                {
+                    Entry.Affinity->Disconnect();
+                }
+
+                if (Entry.IsConcurrentSafe())
+                {
+                    --NumConcurrentSafeTargets;
+                }
+
+                if (NumTombstones++ == 0)
+                {
+                    TombstoneFrame = GFrameCounter;
+                }
+
+                NumObservers.fetch_sub(1, std::memory_order_relaxed);
+
+                if (!IsLocked())
+                {
+                    // nobody can be calling it, release the observer now and leave an empty tombstone
+                    ReleaseObserver(Entry);
+                    Entry.Observer = nullptr;
+                    Entry.Thunk = nullptr;
+
+                    // compact when half of the entries are dead, so a mass removal stays amortized O(1) per observer
+                    if (NumTombstones * 2 >= Targets.Num())
+                    {
+                        Compact();
+                    }
+                }
+            }
+
+            void FBaseSignal::Compact()
+            {
+                check(!IsLocked());
+
+                INC_DWORD_STAT(STAT_GlobalEvents_Compactions);
+
+                // stable compaction, dispatch order of the live observers is unchanged
+                int32 WriteIndex = 0;
+
+                for (int32 ReadIndex = 0; ReadIndex < Targets.Num(); ++ReadIndex)
+                {
+                    const FEventObserverEntry Entry = Targets[ReadIndex];
+
+                    if (Entry.IsPendingDestroy())
+                    {
+                        if (Entry.Observer != nullptr)
+                        {
+                            ReleaseObserver(Entry);
+                        }
+
+                        continue;
+                    }
+
+                    if (WriteIndex != ReadIndex)
                     {
-                        return InPtr->IsPendingDestroy();
+                        Targets[WriteIndex] = Entry;
+                        HandleIndices.FindChecked(Entry.Observer->GetHandle()) = WriteIndex;
                     }
+
+                    ++WriteIndex;
+                }
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+                Targets.SetNum(WriteIndex, EAllowShrinking::No);
+#else
+                Targets.SetNum(WriteIndex, false);
+#endif
+                NumTombstones = 0;
+            }
+
+            bool FBaseSignal::ShouldDispatchInParallel(int32 InNumConcurrentSafe)
+            {
+                return GGlobalEventsParallelDispatchThreshold > 0 &&
+                    InNumConcurrentSafe >= GGlobalEventsParallelDispatchThreshold &&
+                    FApp::ShouldUseThreadingForPerformance();
+            }
+
+            void FBaseSignal::DispatchInParallel(int32 InNum, TFunctionRef<void(int32, int32)> InBatch, TFunctionRef<void()> InSerialWork)
+            {
+                INC_DWORD_STAT(STAT_GlobalEvents_ParallelDispatches);
+
+                // observers are usually cheap, so one task calls a batch of them
+                const int32 BatchSize = FMath::Max(GGlobalEventsParallelDispatchBatchSize, 1);
+                const int32 NumBatches = FMath::DivideAndRoundUp(InNum, BatchSize);
+
+                // the calling thread runs the serial observers first, then helps with the remaining batches until all are done
+                ParallelForWithPreWork(NumBatches, [&](int32 InBatchIndex)
+                    {
+                        const int32 Begin = InBatchIndex * BatchSize;
+
+                        InBatch(Begin, FMath::Min(Begin + BatchSize, InNum));
+                    },
+                    InSerialWork
                 );
             }
 
-            template <typename DisconnectEvaluatorType>
-            bool FBaseSignal::DisconnectImpl(DisconnectEvaluatorType&& InEvaluator)
+            // dynamic parameters are written back through the tuple, so this is always dispatched serially
+            void FBaseSignal::ExecuteRaiseEventInternal(const void* InParams, FCopyEventPayloadFunction InCopyPayload, const void* InPayloadSource)
             {
-                for (int32 i = 0; i < Targets.Num();)
+                if (IsConcurrentDispatch())
                 {
-                    // don't use reference here
-                    auto Instance = Targets[i];
+                    FReadScope ReadScope;
 
-                    // if current instance is pending destroy and not locked, remove it directly.
-                    const bool IsPendingDestroyFlag = Instance->IsPendingDestroy();
-                    if (IsPendingDestroyFlag && !LockedFlag)
+                    if (const FEventObserverSnapshot* Snapshot = PublishedObservers.load(std::memory_order_acquire))
+                    {
+                        ExecuteEntries(Snapshot->Entries, Snapshot->Entries.Num(), InParams, InCopyPayload, InPayloadSource);
+                    }
+
+                    return;
+                }
+
+                if (IsTargetsEmpty())
+                {
+                    return;
+                }
+
+                FUnLockHelper Helper(this);
+
+                if (!Helper.bLocked)
+                {
+                    return;
+                }
+
+                ExecuteEntries(Targets, Targets.Num(), InParams, InCopyPayload, InPayloadSource);
+            }
+
+            void FBaseSignal::ExecuteEntries(const DelegateListType& InEntries, int32 InNum, const void* InParams, FCopyEventPayloadFunction InCopyPayload, const void* InPayloadSource)
+            {
+                FEventObserverAffinity::FDeferredList Deferred;
+
+                for (int32 i = 0; i < InNum; ++i)
+                {
+                    const FEventObserverEntry Entry = InEntries[i];
+
+                    if (Entry.IsPendingDestroy())
                     {
-                        Targets.RemoveAt(i);
                         continue;
                     }
 
-                    // if we find an valid instance, try compare it
-                    if (!IsPendingDestroyFlag && InEvaluator(Instance))
+                    if (Entry.Affinity != nullptr && InCopyPayload != nullptr && !Entry.Affinity->IsInContext())
                     {
-                        // try to remove it
-                        if (LockedFlag)
-                        {
-                            Instance->SetPendingDestroy(true);
-                            ++i;
-                        }
-                        else
+                        Deferred.Add(Entry.Affinity);
+                    }
+                    else
+                    {
+                        Entry.Observer->ExecuteInvoke(InParams);
+                    }
+                }
+
+                if (Deferred.Num() > 0)
+                {
+                    FEventObserverAffinity::Deliver(Deferred, [&]()
                         {
-                            Targets.RemoveAt(i);
+                            return InCopyPayload(InPayloadSource);
                         }
+                    );
+                }
+            }
+
+            int32 FBaseSignal::FindConsumerIndex(const DelegateListType& InEntries, int32 InNum)
+            {
+                int32 ConsumerIndex = INDEX_NONE;
 
-                        return true;
+                for (int32 i = InNum - 1; i >= 0; --i)
+                {
+                    const FEventObserverEntry& Entry = InEntries[i];
+
+                    if (Entry.IsPendingDestroy())
+                    {
+                        continue;
                     }
-                    else
+
+                    // observers bound to another thread copy the values after the loop, none of them may follow the consumer
+                    if (Entry.Affinity != nullptr && !Entry.Affinity->IsInContext())
+                    {
+                        break;
+                    }
+
+                    if (Entry.Thunk != nullptr)
                     {
-                        ++i;
+                        if (ConsumerIndex == INDEX_NONE)
+                        {
+                            ConsumerIndex = i;
+                        }
+
+                        break;
                     }
+
+                    // script observers read one tuple, it can take the values when only script observers are left
+                    ConsumerIndex = i;
                 }
 
-                return false;
+                return ConsumerIndex;
             }
 
             FBaseDynamicSignal::FBaseDynamicSignal()
@@ -194,25 +733,36 @@ namespace UE
                 return (int)ESignalInvokeType::Dynamic;
             }
 
-            void FBaseDynamicSignal::ExecuteRaiseEvent(const void* InParams)
+            // parameters of a dynamic broadcast, copied for the observers bound to another thread
+            class FDynamicTuplePayload : public IEventPayload
             {
-                if (IsTargetsEmpty())
+            public:
+                virtual const void* Get() const override
                 {
-                    return;
+                    return Value.GetData();
                 }
 
-                FUnLockHelper Helper(this);
-
-                for (int32 i = 0; i < Targets.Num(); ++i)
+                static TUniquePtr<IEventPayload> Copy(const void* InParams)
                 {
-                    // don't use reference here
-                    auto Instance = Targets[i];
+                    TUniquePtr<FDynamicTuplePayload> Payload = MakeUnique<FDynamicTuplePayload>();
+                    Payload->Value.CopyFrom(*(const FDynamicTuple*)InParams);
 
-                    if (!Instance->IsPendingDestroy())
-                    {
-                        (Instance.Get())->ExecuteInvoke(InParams);
-                    }
+                    return Payload;
                 }
+
+            private:
+                FDynamicTuple Value;
+            };
+
+            void FBaseDynamicSignal::RaiseDynamicEvent(const FDynamicTuple& InParams)
+            {
+                ExecuteRaiseEventInternal(InParams.GetData(), &FDynamicTuplePayload::Copy, &InParams);
+            }
+
+            void FBaseDynamicSignal::ExecuteRaiseEvent(const void* InParams)
+            {
+                // only the buffer is known here and it can't be copied, observers bound to a thread are called inline, see RaiseDynamicEvent
+                ExecuteRaiseEventInternal(InParams, nullptr, nullptr);
             }
 
             FUFunctionSignal::FUFunctionSignal(const UFunction* InFunction) :
@@ -25,6 +25,8 @@
 */
 #include "Details/Signature.h"
 #include "GlobalEventsLog.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/SoftObjectPath.h"
 
 namespace UE
 {
@@ -32,26 +34,289 @@ namespace UE
     {
         namespace Details
         {
+            // 0 is never a valid epoch, so zero initialized caches are always stale
+            std::atomic<uint32> FSignatureCompatibilityEpoch::Value{ 1 };
+
+            void FSignatureCompatibilityEpoch::Advance()
+            {
+                uint32 Current = Value.load(std::memory_order_relaxed);
+                uint32 Next;
+
+                do
+                {
+                    Next = Current + 1 != 0 ? Current + 1 : 1;
+                } while (!Value.compare_exchange_weak(Current, Next, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            namespace
+            {
+                struct FSignatureRegistryData
+                {
+                    FRWLock                                 Lock;
+
+                    // parameters hash -> id
+                    TMultiMap<uint32, int32>                Buckets;
+                    TArray<TArray<FGlobalEventParamType>>   Parameters;
+                    // paths of the object types of Parameters, null for parameters without one
+                    TArray<TArray<FSoftObjectPath>>         ObjectTypePaths;
+                    // object types of the stored parameters are resolved again from their paths when the epoch changed
+                    TArray<uint32>                          ParametersEpochs;
+
+                    // [target id][invoker id]
+                    TArray<TBitArray<>>                     KnownVerdicts;
+                    TArray<TBitArray<>>                     Verdicts;
+                    uint32                                  VerdictsEpoch = 0;
+
+#if !UE_BUILD_SHIPPING
+                    // names used to be compared instead of parameters, make sure they still agree
+                    TMap<FName, int32>                      NameIds;
+#endif
+                };
+
+                FSignatureRegistryData& GetRegistryData()
+                {
+                    static FSignatureRegistryData Z_Data;
+                    return Z_Data;
+                }
+
+                uint32 GetParametersHash(const TArray<FGlobalEventParamType>& InParameters)
+                {
+                    uint32 Hash = InParameters.Num();
+
+                    for (const FGlobalEventParamType& Parameter : InParameters)
+                    {
+                        // only the fields compared by FGlobalEventParamType::operator ==
+                        Hash = HashCombine(Hash, HashCombine(GetTypeHash(Parameter.GetName()), ((uint32)Parameter.GetTypeId() << 1) | (Parameter.IsPointer() ? 1 : 0)));
+                    }
+
+                    return Hash;
+                }
+
+                bool AreParametersEqual(const TArray<FGlobalEventParamType>& InLeft, const TArray<FGlobalEventParamType>& InRight)
+                {
+                    if (InLeft.Num() != InRight.Num())
+                    {
+                        return false;
+                    }
+
+                    for (int32 i = 0; i < InLeft.Num(); ++i)
+                    {
+                        if (InLeft[i] != InRight[i])
+                        {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+
+                int32 FindParametersId(const FSignatureRegistryData& InData, uint32 InHash, const TArray<FGlobalEventParamType>& InParameters)
+                {
+                    for (TMultiMap<uint32, int32>::TConstKeyIterator It = InData.Buckets.CreateConstKeyIterator(InHash); It; ++It)
+                    {
+                        if (AreParametersEqual(InData.Parameters[It.Value()], InParameters))
+                        {
+                            return It.Value();
+                        }
+                    }
+
+                    return INDEX_NONE;
+                }
+
+                TArray<FSoftObjectPath> GetObjectTypePaths(const TArray<FGlobalEventParamType>& InParameters)
+                {
+                    TArray<FSoftObjectPath> Paths;
+                    Paths.Reserve(InParameters.Num());
+
+                    for (const FGlobalEventParamType& Parameter : InParameters)
+                    {
+                        Paths.Emplace(Parameter.GetObjectType());
+                    }
+
+                    return Paths;
+                }
+
+                // classes may have been unloaded or replaced by a hot reload since the parameters were stored, find them again
+                // a type which can't be found now stays null until a later epoch finds it
+                void RefreshParameters(FSignatureRegistryData& InData, int32 InId, uint32 InEpoch)
+                {
+                    if (InData.ParametersEpochs[InId] == InEpoch)
+                    {
+                        return;
+                    }
+
+                    TArray<FGlobalEventParamType>& Parameters = InData.Parameters[InId];
+                    const TArray<FSoftObjectPath>& Paths = InData.ObjectTypePaths[InId];
+
+                    for (int32 i = 0; i < Parameters.Num(); ++i)
+                    {
+                        if (!Paths[i].IsNull())
+                        {
+                            const FGlobalEventParamType& Parameter = Parameters[i];
+
+                            Parameters[i] = FGlobalEventParamType(Parameter.GetName(), Parameter.GetTypeId(), Parameter.GetFlags(), Cast<UField>(Paths[i].ResolveObject()));
+                        }
+                    }
+
+                    InData.ParametersEpochs[InId] = InEpoch;
+                }
+            }
+
+            int32 FSignatureRegistry::Intern(const TArray<FGlobalEventParamType>& InParameters, const FName& InName)
+            {
+                FSignatureRegistryData& Data = GetRegistryData();
+
+                const uint32 Hash = GetParametersHash(InParameters);
+                const uint32 Epoch = FSignatureCompatibilityEpoch::Get();
+
+                int32 Id = INDEX_NONE;
+
+                {
+                    FRWScopeLock ScopeLock(Data.Lock, SLT_ReadOnly);
+
+                    Id = FindParametersId(Data, Hash, InParameters);
+
+                    // the object types are refreshed by CheckInvokeable when they are needed
+                    if (Id != INDEX_NONE)
+                    {
+                        return Id;
+                    }
+                }
+
+                FRWScopeLock ScopeLock(Data.Lock, SLT_Write);
+
+                Id = FindParametersId(Data, Hash, InParameters);
+
+                if (Id == INDEX_NONE)
+                {
+                    Id = Data.Parameters.Add(InParameters);
+                    Data.ObjectTypePaths.Add(GetObjectTypePaths(InParameters));
+                    Data.ParametersEpochs.Add(Epoch);
+                    Data.Buckets.Add(Hash, Id);
+
+#if !UE_BUILD_SHIPPING
+                    // validated once per distinct signature instead of on every compare
+                    if (!InName.IsNone())
+                    {
+                        const int32* NameIdPtr = Data.NameIds.Find(InName);
+
+                        ensureMsgf(NameIdPtr == nullptr || *NameIdPtr == Id,
+                            TEXT("Signature slow check failure. (%s) is used by different parameter lists."),
+                            *InName.ToString()
+                        );
+
+                        Data.NameIds.Add(InName, Id);
+                    }
+#endif
+                }
+
+                return Id;
+            }
+
+            bool FSignatureRegistry::CheckInvokeable(int32 InTargetId, int32 InInvokerId)
+            {
+                check(InTargetId != INDEX_NONE && InInvokerId != INDEX_NONE);
+
+                // equal parameters are always convertible
+                if (InTargetId == InInvokerId)
+                {
+                    return true;
+                }
+
+                FSignatureRegistryData& Data = GetRegistryData();
+                const uint32 Epoch = FSignatureCompatibilityEpoch::Get();
+
+                {
+                    FRWScopeLock ScopeLock(Data.Lock, SLT_ReadOnly);
+
+                    if (Data.VerdictsEpoch == Epoch &&
+                        Data.KnownVerdicts.IsValidIndex(InTargetId) &&
+                        InInvokerId < Data.KnownVerdicts[InTargetId].Num() &&
+                        Data.KnownVerdicts[InTargetId][InInvokerId])
+                    {
+                        return Data.Verdicts[InTargetId][InInvokerId];
+                    }
+                }
+
+                FRWScopeLock ScopeLock(Data.Lock, SLT_Write);
+
+                if (Data.VerdictsEpoch != Epoch)
+                {
+                    Data.KnownVerdicts.Reset();
+                    Data.Verdicts.Reset();
+                    Data.VerdictsEpoch = Epoch;
+                }
+
+                // signatures are interned once, static ones never again, so their parameters may be older than the epoch
+                RefreshParameters(Data, InTargetId, Epoch);
+                RefreshParameters(Data, InInvokerId, Epoch);
+
+                const TArray<FGlobalEventParamType>& TargetParameters = Data.Parameters[InTargetId];
+                const TArray<FGlobalEventParamType>& InvokerParameters = Data.Parameters[InInvokerId];
+
+                bool bVerdict = TargetParameters.Num() == InvokerParameters.Num();
+
+                for (int32 i = 0; bVerdict && i < TargetParameters.Num(); ++i)
+                {
+                    bVerdict = TargetParameters[i].CheckInvokeConvertibleFrom(InvokerParameters[i]);
+                }
+
+                if (Data.KnownVerdicts.Num() <= InTargetId)
+                {
+                    Data.KnownVerdicts.SetNum(InTargetId + 1);
+                    Data.Verdicts.SetNum(InTargetId + 1);
+                }
+
+                TBitArray<>& KnownRow = Data.KnownVerdicts[InTargetId];
+                TBitArray<>& VerdictRow = Data.Verdicts[InTargetId];
+
+                if (KnownRow.Num() <= InInvokerId)
+                {
+                    KnownRow.Add(false, InInvokerId + 1 - KnownRow.Num());
+                    VerdictRow.Add(false, InInvokerId + 1 - VerdictRow.Num());
+                }
+
+                KnownRow[InInvokerId] = true;
+                VerdictRow[InInvokerId] = bVerdict;
+
+                return bVerdict;
+            }
+
+            int32 FSignatureRegistry::Num()
+            {
+                FSignatureRegistryData& Data = GetRegistryData();
+
+                FRWScopeLock ScopeLock(Data.Lock, SLT_ReadOnly);
+
+                return Data.Parameters.Num();
+            }
+
             FBaseSignature::FBaseSignature()
             {
             }
 
             FBaseSignature::FBaseSignature(const FBaseSignature& InBaseSignature) :
                 Signature(InBaseSignature.Signature),
-                Parameters(InBaseSignature.Parameters)
+                Parameters(InBaseSignature.Parameters),
+                Id(InBaseSignature.Id.load(std::memory_order_relaxed))
             {
             }
 
             FBaseSignature::FBaseSignature(FBaseSignature&& InBaseSignature) :
                 Signature(MoveTemp(InBaseSignature.Signature)),
-                Parameters(MoveTemp(InBaseSignature.Parameters))
+                Parameters(MoveTemp(InBaseSignature.Parameters)),
+                Id(InBaseSignature.Id.load(std::memory_order_relaxed))
             {
+                InBaseSignature.ResetId();
             }
 
             FBaseSignature& FBaseSignature::operator = (FBaseSignature&& InBaseSignature)
             {
                 Signature = MoveTemp(InBaseSignature.Signature);
                 Parameters = MoveTemp(InBaseSignature.Parameters);
+                Id.store(InBaseSignature.Id.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+                InBaseSignature.ResetId();
 
                 return *this;
             }
@@ -61,56 +326,33 @@ namespace UE
                 return Signature;
             }
 
-            const TArray<FGlobalEventParamType>& FBaseSignature::GetParameters() const
+            int32 FBaseSignature::GetId() const
             {
-                return Parameters;
-            }
-
-            bool FBaseSignature::EqualTo(const ISignature* InOtherSignature) const
-            {
-                const bool bEqualToFastResult = EqualToFast(InOtherSignature);
+                int32 CurrentId = Id.load(std::memory_order_relaxed);
 
-#if !UE_BUILD_SHIPPING
-                const bool bEqualToSlowAndSafe = EqualToSlowAndSafe(InOtherSignature);
-
-                checkf(bEqualToSlowAndSafe == bEqualToFastResult,
-                    TEXT("Signature slow check failure. (%s) != (%s)"),
-                    *ToString(),
-                    *InOtherSignature->ToString()
-                );
+                // racing threads intern the same parameters and store the same id
+                if (CurrentId == INDEX_NONE)
+                {
+#if UE_BUILD_SHIPPING
+                    // the name is only used to validate the registry
+                    CurrentId = FSignatureRegistry::Intern(Parameters, NAME_None);
+#else
+                    CurrentId = FSignatureRegistry::Intern(Parameters, GetName());
 #endif
+                    Id.store(CurrentId, std::memory_order_relaxed);
+                }
 
-                return bEqualToFastResult;
+                return CurrentId;
             }
 
-            bool FBaseSignature::EqualToSlowAndSafe(const ISignature* InOtherSignature) const
+            const TArray<FGlobalEventParamType>& FBaseSignature::GetParameters() const
             {
-                if (InOtherSignature == nullptr)
-                {
-                    return false;
-                }
-
-                const TArray<FGlobalEventParamType>& OtherParameters = InOtherSignature->GetParameters();
-
-                if (OtherParameters.Num() != Parameters.Num())
-                {
-                    return false;
-                }
-
-                for (int32 i = 0; i < Parameters.Num(); ++i)
-                {
-                    if (Parameters[i] != OtherParameters[i])
-                    {
-                        return false;
-                    }
-                }
-
-                return true;
+                return Parameters;
             }
 
-            bool FBaseSignature::EqualToFast(const ISignature* InOtherSignature) const
+            bool FBaseSignature::EqualTo(const ISignature* InOtherSignature) const
             {
-                return InOtherSignature != nullptr && GetName() == InOtherSignature->GetName();
+                return InOtherSignature != nullptr && GetId() == InOtherSignature->GetId();
             }
 
             bool FBaseSignature::CheckInvokeableFrom(const ISignature* InInvokerSignature) const
@@ -120,28 +362,15 @@ namespace UE
                     return false;
                 }
 
-                const TArray<FGlobalEventParamType>& InvokerSourceParameters = InInvokerSignature->GetParameters();
-
-                if (InvokerSourceParameters.Num() != Parameters.Num())
-                {
-                    return false;
-                }
-
-                for (int32 i = 0; i < Parameters.Num(); ++i)
-                {
-                    if (!Parameters[i].CheckInvokeConvertibleFrom(InvokerSourceParameters[i]))
-                    {
-                        return false;
-                    }
-                }
-
-                return true;
+                return FSignatureRegistry::CheckInvokeable(GetId(), InInvokerSignature->GetId());
             }
 
             void FBaseSignature::Clear()
             {
                 Signature = FName();
-                Parameters.Empty();
+                Parameters.Reset();
+
+                ResetId();
             }
 
             FDynamicSignature::FDynamicSignature()
@@ -149,12 +378,14 @@ namespace UE
             }
 
             FDynamicSignature::FDynamicSignature(const FDynamicSignature& InOtherSignature) :
-                Super(InOtherSignature)
+                Super(InOtherSignature),
+                bNameOutdated(InOtherSignature.bNameOutdated)
             {
             }
 
             FDynamicSignature::FDynamicSignature(FDynamicSignature&& InOtherSignature) :
-                Super(InOtherSignature)
+                Super(MoveTemp(InOtherSignature)),
+                bNameOutdated(InOtherSignature.bNameOutdated)
             {
             }
 
@@ -162,6 +393,8 @@ namespace UE
             {
                 Super::operator = (MoveTemp(InOtherSignature));
 
+                bNameOutdated = InOtherSignature.bNameOutdated;
+
                 return *this;
             }
 
@@ -172,30 +405,48 @@ namespace UE
 
             void FDynamicSignature::Add(FGlobalEventParamType&& InParamType)
             {
-                AppendTypeString(InParamType.GetName());
+                Parameters.Emplace(MoveTemp(InParamType));
 
-                Parameters.Emplace(InParamType);
+                bNameOutdated = true;
+                ResetId();
             }
 
             void FDynamicSignature::Add(const FGlobalEventParamType& InParamType)
             {
-                AppendTypeString(InParamType.GetName());
-
                 Parameters.Add(InParamType);
+
+                bNameOutdated = true;
+                ResetId();
             }
 
-            void FDynamicSignature::AppendTypeString(const FName& InTypeName)
+            const FName& FDynamicSignature::GetName() const
             {
-                FString Text;
-                if (Signature != NAME_None)
+                if (bNameOutdated)
                 {
-                    Signature.ToString(Text);
-                    Text.Append(TEXT(", "));
+                    TStringBuilder<256> Text;
+
+                    for (int32 i = 0; i < Parameters.Num(); ++i)
+                    {
+                        if (i > 0)
+                        {
+                            Text.Append(TEXT(", "));
+                        }
+
+                        Parameters[i].GetName().AppendString(Text);
+                    }
+
+                    Signature = FName(Text.ToString());
+                    bNameOutdated = false;
                 }
 
-                Text.Append(InTypeName.ToString());
+                return Signature;
+            }
 
-                Signature = *Text;
+            void FDynamicSignature::Clear()
+            {
+                Super::Clear();
+
+                bNameOutdated = false;
             }
 
 
@@ -278,6 +529,9 @@ namespace UE
                 Function = InFunction;
                 Signature = *TempSignature;
 
+                ResetId();
+                GetId();
+
                 return Function != nullptr;
             }
 
@@ -29,6 +29,37 @@
 void UDynamicEventContext::Clear()
 {
     Params.Clear();
+
+    PendingCallSite = NAME_None;
+    bReleasedByBroadcast = false;
+}
+
+void UDynamicEventContext::BeginCallSite(FName CallSite)
+{
+    using namespace UE::GlobalEvents::Details;
+
+    if (const FDynamicTupleLayout* Layout = FDynamicTupleLayout::FindCallSite(CallSite))
+    {
+        Params.Reserve(*Layout);
+
+        PendingCallSite = NAME_None;
+    }
+    else
+    {
+        PendingCallSite = CallSite;
+    }
+}
+
+void UDynamicEventContext::EndCallSite()
+{
+    using namespace UE::GlobalEvents::Details;
+
+    if (!PendingCallSite.IsNone())
+    {
+        FDynamicTupleLayout::SetCallSite(PendingCallSite, FDynamicTupleLayout::FindOrAdd(Params.GetSignature(), Params.GetLayout()));
+
+        PendingCallSite = NAME_None;
+    }
 }
 
 void UDynamicEventContext::Reset(UE::GlobalEvents::FDynamicTuple&& InParams)
@@ -0,0 +1,107 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "DynamicEventContextPool.h"
+#include "DynamicEventContext.h"
+#include "GlobalEventsStats.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+static int32 GGlobalEventsContextPoolSize = 32;
+static FAutoConsoleVariableRef CVarGlobalEventsContextPoolSize(
+    TEXT("GlobalEvents.ContextPoolSize"),
+    GGlobalEventsContextPoolSize,
+    TEXT("Number of released UDynamicEventContext objects an event subsystem keeps for reuse, 0 creates a new context for every broadcast."),
+    ECVF_Default
+);
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        UDynamicEventContext* FDynamicEventContextPool::Acquire()
+        {
+            check(IsInGameThread());
+
+            if (FreeContexts.Num() > 0)
+            {
+                INC_DWORD_STAT(STAT_GlobalEvents_ContextsReused);
+                DEC_DWORD_STAT(STAT_GlobalEvents_PooledContexts);
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+                return FreeContexts.Pop(EAllowShrinking::No);
+#else
+                return FreeContexts.Pop(false);
+#endif
+            }
+
+            INC_DWORD_STAT(STAT_GlobalEvents_ContextsCreated);
+
+            UObject* ContextOuter = Outer.Get();
+
+            return NewObject<UDynamicEventContext>(ContextOuter != nullptr ? ContextOuter : GetTransientPackage());
+        }
+
+        void FDynamicEventContextPool::Release(UDynamicEventContext* InContext)
+        {
+            check(IsInGameThread());
+
+            if (InContext == nullptr)
+            {
+                return;
+            }
+
+            // free the parameters now, a dropped context may wait a while for the GC
+            InContext->Clear();
+
+            if (FreeContexts.Num() < GGlobalEventsContextPoolSize && !InContext->IsUnreachable())
+            {
+                checkSlow(!FreeContexts.Contains(InContext));
+
+                FreeContexts.Add(InContext);
+
+                INC_DWORD_STAT(STAT_GlobalEvents_PooledContexts);
+            }
+        }
+
+        void FDynamicEventContextPool::Empty()
+        {
+            DEC_DWORD_STAT_BY(STAT_GlobalEvents_PooledContexts, FreeContexts.Num());
+
+            FreeContexts.Empty();
+        }
+
+        void FDynamicEventContextPool::AddReferencedObjects(FReferenceCollector& InCollector)
+        {
+            InCollector.AddReferencedObjects(FreeContexts);
+        }
+
+        FString FDynamicEventContextPool::GetReferencerName() const
+        {
+            return TEXT("FDynamicEventContextPool");
+        }
+    }
+}
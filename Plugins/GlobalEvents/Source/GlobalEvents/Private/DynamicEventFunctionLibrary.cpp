@@ -26,6 +26,8 @@
 #include "DynamicEventFunctionLibrary.h"
 #include "DynamicEventContext.h"
 #include "GameEventSubsystem.h"
+#include "UObject/Package.h"
+#include "Runtime/Launch/Resources/Version.h"
 
 const FName UDynamicEventFunctionLibrary::PushDynamicEventFunctionName = GET_FUNCTION_NAME_CHECKED(UDynamicEventFunctionLibrary, PushDynamicEventParam);
 
@@ -33,9 +35,33 @@ bool UDynamicEventFunctionLibrary::BroadcastEvent(FGameplayTag EventTag, UDynami
 {
     check(Context != nullptr);
 
+    Context->EndCallSite();
+
     UGameEventSubsystem* Subsystem = UGameEventSubsystem::GetInstance(Context);
 
-    return Subsystem != nullptr && Subsystem->BroadcastDynamic(EventTag.GetTagName(), Context);
+    const bool bResult = Subsystem != nullptr && Subsystem->BroadcastDynamic(EventTag.GetTagName(), Context);
+
+    if (Context->bReleasedByBroadcast && Subsystem != nullptr)
+    {
+        Subsystem->ReleaseDynamicEventContext(Context);
+    }
+
+    return bResult;
+}
+
+UDynamicEventContext* UDynamicEventFunctionLibrary::AcquireEventContext(UObject* WorldContextObject)
+{
+    UGameEventSubsystem* Subsystem = UGameEventSubsystem::GetInstance(WorldContextObject);
+
+    if (Subsystem == nullptr)
+    {
+        return NewObject<UDynamicEventContext>(WorldContextObject != nullptr ? WorldContextObject : GetTransientPackage());
+    }
+
+    UDynamicEventContext* Context = Subsystem->AcquireDynamicEventContext();
+    Context->bReleasedByBroadcast = true;
+
+    return Context;
 }
 
 void UDynamicEventFunctionLibrary::PushDynamicEventParam(UDynamicEventContext* Context, const int32& Value)
@@ -64,6 +90,62 @@ DEFINE_FUNCTION(UDynamicEventFunctionLibrary::execPushDynamicEventParam)
     P_NATIVE_END;
 }
 
+bool UDynamicEventFunctionLibrary::BroadcastEventWithParams(UObject* WorldContextObject, FGameplayTag EventTag, FName CallSite)
+{
+    // it will not be called.
+    check(0);
+    return false;
+}
+
+DEFINE_FUNCTION(UDynamicEventFunctionLibrary::execBroadcastEventWithParams)
+{
+    using namespace UE::GlobalEvents::Details;
+
+    P_GET_OBJECT(UObject, WorldContextObject);
+    P_GET_STRUCT(FGameplayTag, EventTag);
+    P_GET_PROPERTY(FNameProperty, CallSite);
+
+    UE::GlobalEvents::FDynamicTuple Params;
+
+    const FDynamicTupleLayout* Layout = FDynamicTupleLayout::FindCallSite(CallSite);
+
+    if (Layout != nullptr)
+    {
+        Params.Reserve(*Layout);
+    }
+
+    // the variadic parameters follow the declared ones
+    while (Stack.PeekCode() != EX_EndFunctionParms)
+    {
+        // a stale value of the previous parameter must not be taken for this one
+        Stack.MostRecentProperty = nullptr;
+        Stack.MostRecentPropertyAddress = nullptr;
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+        Stack.MostRecentPropertyContainer = nullptr;
+#endif
+
+        Stack.StepCompiledIn<FProperty>(nullptr);
+
+        checkf(Stack.MostRecentProperty != nullptr, TEXT("A parameter of Broadcast Global Event at %s has no property."), *CallSite.ToString());
+        checkf(Stack.MostRecentPropertyAddress != nullptr, TEXT("A parameter of Broadcast Global Event at %s has no address."), *CallSite.ToString());
+
+        Params.Push(Stack.MostRecentProperty, Stack.MostRecentPropertyAddress);
+    }
+
+    P_FINISH;
+
+    P_NATIVE_BEGIN;
+    if (Layout == nullptr)
+    {
+        FDynamicTupleLayout::SetCallSite(CallSite, FDynamicTupleLayout::FindOrAdd(Params.GetSignature(), Params.GetLayout()));
+    }
+
+    UGameEventSubsystem* Subsystem = UGameEventSubsystem::GetInstance(WorldContextObject);
+
+    *(bool*)RESULT_PARAM = Subsystem != nullptr && Subsystem->BroadcastDynamic(EventTag.GetTagName(), MoveTemp(Params));
+    P_NATIVE_END;
+}
+
 bool UDynamicEventFunctionLibrary::RegisterGlobalEvent(FGameplayTag EventTag, UObject* Target, FName FunctionName)
 {
     check(Target != nullptr);
@@ -82,3 +164,10 @@ bool UDynamicEventFunctionLibrary::UnRegisterGlobalEvent(FGameplayTag EventTag,
     return Subsystem != nullptr && Subsystem->UnRegister(EventTag.GetTagName(), Target, FunctionName);
 }
 
+bool UDynamicEventFunctionLibrary::HasGlobalEventListeners(UObject* WorldContextObject, FGameplayTag EventTag)
+{
+    UGameEventSubsystem* Subsystem = UGameEventSubsystem::GetInstance(WorldContextObject);
+
+    return Subsystem != nullptr && Subsystem->HasListeners(EventTag.GetTagName());
+}
+
@@ -29,67 +29,220 @@ namespace UE
 {
     namespace GlobalEvents
     {
-        FDynamicTuple::FDynamicTuple()
+        namespace
+        {
+            // reflected values have no move, so moving one is a copy
+            const Details::FDynamicTupleElementOps ScriptStructElementOps =
+            {
+                [](const void* InContext, void* InDest, const void* InSource)
+                {
+                    const UScriptStruct* ScriptStruct = (const UScriptStruct*)InContext;
+
+                    ScriptStruct->InitializeStruct(InDest);
+                    ScriptStruct->CopyScriptStruct(InDest, InSource);
+                },
+                [](const void* InContext, void* InDest, void* InSource)
+                {
+                    const UScriptStruct* ScriptStruct = (const UScriptStruct*)InContext;
+
+                    ScriptStruct->InitializeStruct(InDest);
+                    ScriptStruct->CopyScriptStruct(InDest, InSource);
+                },
+                [](const void* InContext, void* InAddress)
+                {
+                    ((const UScriptStruct*)InContext)->DestroyStruct(InAddress);
+                }
+            };
+
+            const Details::FDynamicTupleElementOps PropertyElementOps =
+            {
+                [](const void* InContext, void* InDest, const void* InSource)
+                {
+                    const FProperty* Property = (const FProperty*)InContext;
+
+                    Property->InitializeValue(InDest);
+                    Property->CopyCompleteValue(InDest, InSource);
+                },
+                [](const void* InContext, void* InDest, void* InSource)
+                {
+                    const FProperty* Property = (const FProperty*)InContext;
+
+                    Property->InitializeValue(InDest);
+                    Property->CopyCompleteValue(InDest, InSource);
+                },
+                [](const void* InContext, void* InAddress)
+                {
+                    ((const FProperty*)InContext)->DestroyValue(InAddress);
+                }
+            };
+        }
+
+        FDynamicTuple::FDynamicTuple() :
+            Buffer(InlineBuffer),
+            Capacity(InlineCapacity)
         {
         }
 
         FDynamicTuple::~FDynamicTuple()
         {
             Clear();
+
+            if (!IsInline())
+            {
+                FMemory::Free(Buffer);
+            }
         }
 
         FDynamicTuple::FDynamicTuple(FDynamicTuple&& InOther) :
-            TupleBuffer(MoveTemp(InOther.TupleBuffer)),
-            TupleElementRecords(MoveTemp(InOther.TupleElementRecords)),
-            Signature(MoveTemp(InOther.Signature))
+            Buffer(InlineBuffer),
+            Capacity(InlineCapacity)
         {
+            MoveFrom(InOther);
         }
 
         FDynamicTuple& FDynamicTuple::operator= (FDynamicTuple&& InOther)
         {
-            TupleBuffer = MoveTemp(InOther.TupleBuffer);
+            if (this != &InOther)
+            {
+                Clear();
+
+                if (!IsInline())
+                {
+                    FMemory::Free(Buffer);
+
+                    Buffer = InlineBuffer;
+                    Capacity = InlineCapacity;
+                }
+
+                MoveFrom(InOther);
+            }
+
+            return *this;
+        }
+
+        void FDynamicTuple::MoveFrom(FDynamicTuple& InOther)
+        {
+            checkSlow(IsInline() && TupleElementRecords.Num() == 0);
+
+            if (InOther.IsInline())
+            {
+                // elements are bitwise relocatable, as they are in TArray
+                FMemory::Memcpy(InlineBuffer, InOther.InlineBuffer, InOther.Layout.GetSize());
+            }
+            else
+            {
+                Buffer = InOther.Buffer;
+                Capacity = InOther.Capacity;
+
+                InOther.Buffer = InOther.InlineBuffer;
+                InOther.Capacity = InlineCapacity;
+            }
+
+            Layout = MoveTemp(InOther.Layout);
             TupleElementRecords = MoveTemp(InOther.TupleElementRecords);
             Signature = MoveTemp(InOther.Signature);
 
-            return *this;
+            // the elements are owned by this tuple now
+            InOther.Layout.Reset();
+            InOther.TupleElementRecords.Reset();
+            InOther.Signature.Clear();
         }
 
         void FDynamicTuple::Clear()
         {
             for (int32 i = 0; i < TupleElementRecords.Num(); ++i)
             {
-                if (TupleElementRecords[i].Deletor)
-                {
-                    const void* Address = TupleBuffer.GetData() + TupleElementRecords[i].Offset;
+                const FParamRecord& Record = TupleElementRecords[i];
 
-                    TupleElementRecords[i].Deletor(Address);
+                if (Record.Ops->Destroy != nullptr)
+                {
+                    Record.Ops->Destroy(Record.Context, Buffer + Layout.GetOffset(i));
                 }
             }
 
-            TupleBuffer.Empty();
-            TupleElementRecords.Empty();
+            Layout.Reset();
+            TupleElementRecords.Reset();
             Signature.Clear();
         }
 
-        void FDynamicTuple::PushInternal(int InElementSize, int InAlignmentSize, TFunction<void(const void*)>&& InCopyFunctor, TFunction<void(const void*)>&& InDeleteFunctor)
+        void FDynamicTuple::Reserve(const Details::FDynamicTupleLayout& InLayout)
         {
-            const int OrignalOffset = TupleBuffer.Num();
-            const int PreAppendOffset = (int)AlignAddress(OrignalOffset, InAlignmentSize);
-            const int Padding = PreAppendOffset - OrignalOffset;
-            checkSlow(Padding >= 0);
+            if (InLayout.GetSize() > Capacity || InLayout.GetAlignment() > InlineAlignment)
+            {
+                Grow(InLayout.GetSize(), InLayout.GetAlignment());
+            }
 
-            TupleBuffer.AddZeroed(InElementSize + Padding);
+            TupleElementRecords.Reserve(InLayout.Num());
+            Signature.Reserve(InLayout.Num());
+        }
 
-            const uint8* Address = TupleBuffer.GetData() + PreAppendOffset;
+        void FDynamicTuple::CopyFrom(const FDynamicTuple& InOther)
+        {
+            check(TupleElementRecords.Num() == 0);
+
+            Reserve(InOther.Layout);
 
-            // copy data to this buffer
-            InCopyFunctor(Address);
+            // the padding is copied as well, the buffer is handed to ProcessEvent as is
+            FMemory::Memzero(Buffer, InOther.Layout.GetSize());
 
-            FParamRecord Record;
-            Record.Offset = PreAppendOffset;
-            Record.Deletor = InDeleteFunctor;
+            for (int32 i = 0; i < InOther.TupleElementRecords.Num(); ++i)
+            {
+                const FParamRecord& Record = InOther.TupleElementRecords[i];
+                const uint32 Offset = InOther.Layout.GetOffset(i);
+
+                Record.Ops->Copy(Record.Context, Buffer + Offset, InOther.Buffer + Offset);
+            }
 
-            TupleElementRecords.Emplace(Record);
+            Layout = InOther.Layout;
+            TupleElementRecords = InOther.TupleElementRecords;
+            Signature = FDynamicSignature(InOther.Signature);
+        }
+
+        void FDynamicTuple::Grow(uint32 InCapacity, uint32 InAlignment)
+        {
+            // the elements already pushed keep their alignment when a less aligned one makes the buffer grow
+            const uint32 Alignment = FMath::Max3(InAlignment, Layout.GetAlignment(), InlineAlignment);
+
+            // heap buffers are allocated with the inline alignment unless an element needs more
+            if (InCapacity <= Capacity && (IsInline() ? Alignment == InlineAlignment : IsAligned(Buffer, Alignment)))
+            {
+                return;
+            }
+
+            const uint32 NewCapacity = FMath::Max(InCapacity, Capacity * 2);
+            uint8* NewBuffer = (uint8*)FMemory::Malloc(NewCapacity, Alignment);
+
+            FMemory::Memcpy(NewBuffer, Buffer, Layout.GetSize());
+
+            if (!IsInline())
+            {
+                FMemory::Free(Buffer);
+            }
+
+            Buffer = NewBuffer;
+            Capacity = NewCapacity;
+        }
+
+        void* FDynamicTuple::PushInternal(const Details::FDynamicTupleElementOps* InOps, const void* InContext, int InElementSize, int InAlignmentSize)
+        {
+            const uint32 OriginalSize = Layout.GetSize();
+            const uint32 Offset = Details::FDynamicTupleLayout::AlignOffset(OriginalSize, InAlignmentSize);
+
+            if (Offset + InElementSize > Capacity || (uint32)InAlignmentSize > InlineAlignment)
+            {
+                Grow(Offset + InElementSize, InAlignmentSize);
+            }
+
+            Layout.Add(InElementSize, InAlignmentSize);
+
+            // keep the padding deterministic, the buffer is handed to ProcessEvent as is
+            FMemory::Memzero(Buffer + OriginalSize, Offset - OriginalSize);
+
+            FParamRecord& Record = TupleElementRecords.AddDefaulted_GetRef();
+            Record.Ops = InOps;
+            Record.Context = InContext;
+
+            return Buffer + Offset;
         }
 
         void FDynamicTuple::Push(const UScriptStruct* InScriptStruct, const void* InAddress)
@@ -97,27 +250,9 @@ namespace UE
             check(InAddress != nullptr);
             check(InScriptStruct != nullptr);
 
-            const int32 StructSize = InScriptStruct->GetStructureSize();
+            void* Address = PushInternal(&ScriptStructElementOps, InScriptStruct, InScriptStruct->GetStructureSize(), InScriptStruct->GetMinAlignment());
 
-            PushInternal(
-                StructSize,
-                InScriptStruct->GetCppStructOps()->GetAlignment(),
-                [=](const void* Address)
-                {
-                    // must initialize
-                    InScriptStruct->InitializeStruct((void*)InAddress);
-
-                    // copy from external address
-                    InScriptStruct->CopyScriptStruct((void*)Address, (void*)InAddress);
-                },
-                [=](const void* InPtr)
-                {
-                    if (InPtr != nullptr)
-                    {
-                        InScriptStruct->DestroyStruct((void*)InPtr);
-                    }
-                }
-            );
+            ScriptStructElementOps.Copy(InScriptStruct, Address, InAddress);
 
             Signature.Add(FGlobalEventParamType(InScriptStruct));
         }
@@ -127,27 +262,9 @@ namespace UE
             check(InProperty != nullptr);
             check(InSourceAddress != nullptr);
 
-            const int32 PropertySize = InProperty->GetSize();
+            void* Address = PushInternal(&PropertyElementOps, InProperty, InProperty->GetSize(), InProperty->GetMinAlignment());
 
-            PushInternal(
-                PropertySize,
-                InProperty->GetMinAlignment(),
-                [=](const void* Address)
-                {
-                    // must initialize
-                    InProperty->InitializeValue((void*)Address);
-
-                    // copy value
-                    InProperty->CopyCompleteValue((void*)Address, (void*)InSourceAddress);
-                },
-                [=](const void* InPtr)
-                {
-                    if (InPtr != nullptr)
-                    {
-                        InProperty->DestroyValue((void*)InPtr);
-                    }
-                }
-            );
+            PropertyElementOps.Copy(InProperty, Address, InSourceAddress);
 
             Signature.Add(FGlobalEventParamType(InProperty));
         }
@@ -26,20 +26,334 @@
 
 #include "GameEventSubsystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+static int32 GGlobalEventsConcurrentMode = 0;
+static FAutoConsoleVariableRef CVarGlobalEventsConcurrentMode(
+	TEXT("GlobalEvents.ConcurrentMode"),
+	GGlobalEventsConcurrentMode,
+	TEXT("If not 0, event subsystems are created in concurrent mode, which allows Broadcast from any thread.\n")
+	TEXT("See UGameEventSubsystem::EnableConcurrentMode."),
+	ECVF_Default
+);
+
+static int32 GGlobalEventsQueueArenaSize = 256;
+static FAutoConsoleVariableRef CVarGlobalEventsQueueArenaSize(
+	TEXT("GlobalEvents.QueueArenaSize"),
+	GGlobalEventsQueueArenaSize,
+	TEXT("Size in KB of the ring arena that stores the events posted by Enqueue, events that don't fit are allocated from the heap.\n")
+	TEXT("Applies to event subsystems created afterwards."),
+	ECVF_Default
+);
+
+static int32 GGlobalEventsQueueTickGroup = TG_PrePhysics;
+static FAutoConsoleVariableRef CVarGlobalEventsQueueTickGroup(
+	TEXT("GlobalEvents.QueueTickGroup"),
+	GGlobalEventsQueueTickGroup,
+	TEXT("ETickingGroup in which the events posted by Enqueue are broadcast, from 0 (TG_PrePhysics) to 5 (TG_PostUpdateWork).\n")
+	TEXT("Applies to worlds initialized afterwards."),
+	ECVF_Default
+);
+
+static float GGlobalEventsDeferredBudgetMs = 1.0f;
+static FAutoConsoleVariableRef CVarGlobalEventsDeferredBudgetMs(
+	TEXT("GlobalEvents.DeferredBudgetMs"),
+	GGlobalEventsDeferredBudgetMs,
+	TEXT("Milliseconds per frame an event subsystem may spend on broadcasting deferred events, overdue events are not limited by it."),
+	ECVF_Default
+);
+
+// indexed by EGlobalEventPriority
+static float GGlobalEventsDeferredMaxLatencyMs[] = { 0.0f, 100.0f, 1000.0f };
+
+static FAutoConsoleVariableRef CVarGlobalEventsDeferredMaxLatencyHighMs(
+	TEXT("GlobalEvents.DeferredMaxLatencyMs.High"),
+	GGlobalEventsDeferredMaxLatencyMs[(int32)EGlobalEventPriority::High],
+	TEXT("Milliseconds a deferred event of high priority may wait before it is broadcast regardless of the budget, 0 means the next frame."),
+	ECVF_Default
+);
+
+static FAutoConsoleVariableRef CVarGlobalEventsDeferredMaxLatencyNormalMs(
+	TEXT("GlobalEvents.DeferredMaxLatencyMs.Normal"),
+	GGlobalEventsDeferredMaxLatencyMs[(int32)EGlobalEventPriority::Normal],
+	TEXT("Milliseconds a deferred event of normal priority may wait before it is broadcast regardless of the budget."),
+	ECVF_Default
+);
+
+static FAutoConsoleVariableRef CVarGlobalEventsDeferredMaxLatencyLowMs(
+	TEXT("GlobalEvents.DeferredMaxLatencyMs.Low"),
+	GGlobalEventsDeferredMaxLatencyMs[(int32)EGlobalEventPriority::Low],
+	TEXT("Milliseconds a deferred event of low priority may wait before it is broadcast regardless of the budget."),
+	ECVF_Default
+);
 
 void UGameEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	if (GGlobalEventsConcurrentMode != 0)
+	{
+		EnableConcurrentMode();
+	}
+
+	InitializeEventQueue();
+
+	// pooled contexts find this subsystem through their outer, so scripts can broadcast them again
+	DynamicEventContextPool.SetOuter(this);
 }
 
 void UGameEventSubsystem::Deinitialize()
 {
+	DeinitializeEventQueue();
+	DeferredEvents.Discard();
+	ResetCoalescedEvents();
+	DynamicEventContextPool.Empty();
+
 	Shutdown();
 
+	if (bConcurrentMode)
+	{
+		{
+			FScopeLock ScopeLock(&EventTableLock);
+
+			if (FPublishedEventTable* Table = PublishedEventTable.exchange(nullptr))
+			{
+				UE::GlobalEvents::Details::FReadCopyUpdate::Retire([Table]()
+					{
+						delete Table;
+					}
+				);
+			}
+		}
+
+		// wait for the broadcasts of other threads before the signals are gone
+		UE::GlobalEvents::Details::FReadCopyUpdate::Synchronize();
+	}
+
 	Super::Deinitialize();
 }
 
+bool UGameEventSubsystem::EnableConcurrentMode()
+{
+	FScopeLock ScopeLock(&EventTableLock);
+
+	if (bConcurrentMode)
+	{
+		return true;
+	}
+
+	if (EventSlots.Num() > 0)
+	{
+		UE_LOG(GlobalEventsLog, Warning, TEXT("Concurrent mode must be enabled before any event is registered."));
+
+		return false;
+	}
+
+	bConcurrentMode = true;
+
+	PublishEventTable();
+
+	return true;
+}
+
+void UGameEventSubsystem::PublishEventTable()
+{
+	check(bConcurrentMode);
+
+	bEventTableChanged = false;
+
+	FPublishedEventTable* Table = new FPublishedEventTable();
+	Table->SlotIndices = EventSlotIndices;
+	Table->TypeSafeSlotIndices = TypeSafeSlotIndices;
+	Table->Signals.Reserve(EventSlots.Num());
+
+	for (const FEventSlotEntry& Slot : EventSlots)
+	{
+		Table->Signals.Add(Slot.Signal.Get());
+	}
+
+	FPublishedEventTable* OldTable = PublishedEventTable.exchange(Table, std::memory_order_acq_rel);
+
+	// readers that loaded the old table may still dispatch on the removed signals
+	if (OldTable != nullptr || RemovedSignals.Num() > 0)
+	{
+		UE::GlobalEvents::Details::FReadCopyUpdate::Retire([OldTable, Signals = MoveTemp(RemovedSignals)]()
+			{
+				delete OldTable;
+			}
+		);
+
+		RemovedSignals.Reset();
+	}
+}
+
+void UGameEventSubsystem::InitializeEventQueue()
+{
+	EventQueue = MakeUnique<UE::GlobalEvents::Details::FEventQueue>(GGlobalEventsQueueArenaSize * 1024);
+
+	QueueTickFunction.Owner = this;
+	QueueTickFunction.bCanEverTick = true;
+	QueueTickFunction.bTickEvenWhenPaused = true;
+	QueueTickFunction.bStartWithTickEnabled = true;
+
+	PostWorldInitializationHandle = FWorldDelegates::OnPostWorldInitialization.AddWeakLambda(this, [this](UWorld* InWorld, const UWorld::InitializationValues)
+		{
+			RegisterQueueTickFunction(InWorld);
+		}
+	);
+
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddWeakLambda(this, [this](UWorld* InWorld, bool, bool)
+		{
+			if (QueueTickWorld.Get() == InWorld)
+			{
+				// deliver what the world has posted while its observers are still alive
+				FlushQueuedEvents();
+				DrainDeferredEvents(TNumericLimits<double>::Max());
+				FlushCoalescedEvents();
+				UnRegisterQueueTickFunction();
+			}
+		}
+	);
+
+	RegisterQueueTickFunction(GetGameInstance()->GetWorld());
+}
+
+void UGameEventSubsystem::DeinitializeEventQueue()
+{
+	FWorldDelegates::OnPostWorldInitialization.Remove(PostWorldInitializationHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+
+	UnRegisterQueueTickFunction();
+
+	// events posted after the last flush are dropped
+	EventQueue.Reset();
+}
+
+void UGameEventSubsystem::RegisterQueueTickFunction(UWorld* InWorld)
+{
+	if (InWorld == nullptr || !InWorld->IsGameWorld() || InWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	UnRegisterQueueTickFunction();
+
+	QueueTickFunction.TickGroup = (ETickingGroup)FMath::Clamp(GGlobalEventsQueueTickGroup, 0, (int32)TG_PostUpdateWork);
+	QueueTickFunction.RegisterTickFunction(InWorld->PersistentLevel);
+
+	QueueTickWorld = InWorld;
+}
+
+void UGameEventSubsystem::UnRegisterQueueTickFunction()
+{
+	if (QueueTickFunction.IsTickFunctionRegistered())
+	{
+		QueueTickFunction.UnRegisterTickFunction();
+	}
+
+	QueueTickWorld.Reset();
+}
+
+int32 UGameEventSubsystem::FlushQueuedEvents()
+{
+	check(IsInGameThread());
+
+	return EventQueue.IsValid() ? EventQueue->Drain(this) : 0;
+}
+
+int32 UGameEventSubsystem::DrainDeferredEvents(double InBudgetSeconds)
+{
+	check(IsInGameThread());
+
+	if (DeferredEvents.Num() == 0)
+	{
+		return 0;
+	}
+
+	static_assert(UE_ARRAY_COUNT(GGlobalEventsDeferredMaxLatencyMs) == UE::GlobalEvents::Details::FDeferredEventQueue::NumPriorities, "One max latency per priority.");
+
+	double MaxLatencySeconds[UE::GlobalEvents::Details::FDeferredEventQueue::NumPriorities];
+
+	for (int32 Priority = 0; Priority < UE::GlobalEvents::Details::FDeferredEventQueue::NumPriorities; ++Priority)
+	{
+		MaxLatencySeconds[Priority] = GGlobalEventsDeferredMaxLatencyMs[Priority] / 1000.0;
+	}
+
+	return DeferredEvents.Drain(this, InBudgetSeconds, MaxLatencySeconds);
+}
+
+int32 UGameEventSubsystem::FlushCoalescedEvents()
+{
+	check(IsInGameThread());
+
+	TArray<UE::GlobalEvents::Details::ICoalescedEvent*> Events;
+
+	{
+		FScopeLock ScopeLock(&CoalescingLock);
+
+		Events = MoveTemp(PendingCoalescedEvents);
+		PendingCoalescedEvents.Reset();
+
+		for (UE::GlobalEvents::Details::ICoalescedEvent* Event : Events)
+		{
+			Event->bPending = false;
+			Event->Take();
+		}
+	}
+
+	int32 NumBroadcasts = 0;
+
+	for (UE::GlobalEvents::Details::ICoalescedEvent* Event : Events)
+	{
+		NumBroadcasts += Event->Dispatch(this);
+	}
+
+	INC_DWORD_STAT_BY(STAT_GlobalEvents_CoalescedDispatches, NumBroadcasts);
+
+	return NumBroadcasts;
+}
+
+void UGameEventSubsystem::ResetCoalescedEvents()
+{
+	FScopeLock ScopeLock(&CoalescingLock);
+
+	// pending values are dropped like the queued events
+	PendingCoalescedEvents.Empty();
+	CoalescedEvents.Empty();
+}
+
+void UGameEventSubsystem::FEventQueueTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	// queued and deferred events may be coalesced, so they are merged into this flush
+	Owner->FlushQueuedEvents();
+	Owner->DrainDeferredEvents(GGlobalEventsDeferredBudgetMs / 1000.0);
+	Owner->FlushCoalescedEvents();
+}
+
+FString UGameEventSubsystem::FEventQueueTickFunction::DiagnosticMessage()
+{
+	return TEXT("UGameEventSubsystem::FlushQueuedEvents");
+}
+
+uint32 UGameEventSubsystem::GenerateEventSlotsSerial()
+{
+	// event centers may be created while slots are resolved on other threads in concurrent mode
+	static std::atomic<uint32> Z_Serial{ 0 };
+
+	uint32 Serial;
+
+	// 0 is the serial of unresolved slots
+	do
+	{
+		Serial = Z_Serial.fetch_add(1, std::memory_order_relaxed) + 1;
+	} while (Serial == 0);
+
+	return Serial;
+}
+
 UGameEventSubsystem* UGameEventSubsystem::GetInstance(const UObject* InContext)
 {
     UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(InContext);
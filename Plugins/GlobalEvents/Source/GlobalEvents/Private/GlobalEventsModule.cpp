@@ -25,6 +25,9 @@
 */
 
 #include "IGlobalEventsModule.h"
+#include "Details/Signature.h"
+#include "UObject/UObjectGlobals.h"
+#include "Runtime/Launch/Resources/Version.h"
 
 IGlobalEventsModule& IGlobalEventsModule::Get()
 {
@@ -36,13 +39,31 @@ class FGlobalEventsModule : public IGlobalEventsModule
 public:
     virtual void StartupModule() override
     {
+        using UE::GlobalEvents::Details::FSignatureCompatibilityEpoch;
 
+        // object parameter compatibility depends on the class hierarchy, drop cached verdicts when it may change
+        PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FSignatureCompatibilityEpoch::Advance);
+
+#if ENGINE_MAJOR_VERSION >= 5
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+            {
+                FSignatureCompatibilityEpoch::Advance();
+            });
+#endif
     }
 
     virtual void ShutdownModule() override
     {
+        FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
 
+#if ENGINE_MAJOR_VERSION >= 5
+        FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#endif
     }
+
+private:
+    FDelegateHandle PostGarbageCollectHandle;
+    FDelegateHandle ReloadCompleteHandle;
 };
 
 IMPLEMENT_MODULE(FGlobalEventsModule, GlobalEvents)
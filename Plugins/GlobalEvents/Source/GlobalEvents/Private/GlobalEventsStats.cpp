@@ -0,0 +1,41 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#include "GlobalEventsStats.h"
+
+DEFINE_STAT(STAT_GlobalEvents_Compactions);
+DEFINE_STAT(STAT_GlobalEvents_CompactionsSkipped);
+DEFINE_STAT(STAT_GlobalEvents_CompactionEntriesSkipped);
+DEFINE_STAT(STAT_GlobalEvents_ParallelDispatches);
+DEFINE_STAT(STAT_GlobalEvents_CoalescedBroadcasts);
+DEFINE_STAT(STAT_GlobalEvents_CoalescedDispatches);
+DEFINE_STAT(STAT_GlobalEvents_DeferredDrain);
+DEFINE_STAT(STAT_GlobalEvents_DeferredQueueDepth);
+DEFINE_STAT(STAT_GlobalEvents_DeferredBudgetUsed);
+DEFINE_STAT(STAT_GlobalEvents_DeferredMaxLatency);
+DEFINE_STAT(STAT_GlobalEvents_DeferredOverdue);
+DEFINE_STAT(STAT_GlobalEvents_ContextsCreated);
+DEFINE_STAT(STAT_GlobalEvents_ContextsReused);
+DEFINE_STAT(STAT_GlobalEvents_PooledContexts);
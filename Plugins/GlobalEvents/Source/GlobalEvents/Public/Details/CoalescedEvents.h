@@ -0,0 +1,157 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            /*
+            * Values of a coalesced event broadcast since the last flush, see DEFINE_COALESCED_TYPESAFE_GLOBAL_EVENT.
+            * Add and Take are serialized by the owner, Dispatch only reads what Take moved aside,
+            * so values added by the observers during Dispatch are kept for the next flush.
+            */
+            class ICoalescedEvent
+            {
+            public:
+                typedef void (*FDispatchFunction)(void* InContext, void* InPayload);
+
+                ICoalescedEvent(FDispatchFunction InDispatchFunction) :
+                    DispatchFunction(InDispatchFunction)
+                {
+                }
+
+                virtual ~ICoalescedEvent() = default;
+
+                // move the pending values aside for Dispatch
+                virtual void Take() = 0;
+
+                // broadcast the values moved aside by Take, returns the number of broadcasts
+                virtual int32 Dispatch(void* InContext) = 0;
+
+                // true when the event is in the pending list of its owner
+                bool bPending = false;
+
+            protected:
+                FDispatchFunction DispatchFunction;
+            };
+
+            // only the last value is broadcast
+            template <typename PayloadType>
+            class TLastValueCoalescedEvent final : public ICoalescedEvent
+            {
+            public:
+                using ICoalescedEvent::ICoalescedEvent;
+
+                template <typename... ArgTypes>
+                void Add(ArgTypes&&... InArgs)
+                {
+                    Pending.Emplace(Forward<ArgTypes>(InArgs)...);
+                }
+
+                virtual void Take() override
+                {
+                    Taken = MoveTemp(Pending);
+                    Pending.Reset();
+                }
+
+                virtual int32 Dispatch(void* InContext) override
+                {
+                    if (!Taken.IsSet())
+                    {
+                        return 0;
+                    }
+
+                    PayloadType Payload = MoveTemp(Taken.GetValue());
+                    Taken.Reset();
+
+                    DispatchFunction(InContext, &Payload);
+
+                    return 1;
+                }
+
+            private:
+                TOptional<PayloadType> Pending;
+                TOptional<PayloadType> Taken;
+            };
+
+            // the last value of every key is broadcast, keys are the first parameter and keep the order of their first broadcast
+            template <typename PayloadType>
+            class TKeyedCoalescedEvent final : public ICoalescedEvent
+            {
+            public:
+                typedef typename TDecay<decltype(DeclVal<PayloadType&>().template Get<0>())>::Type KeyType;
+
+                using ICoalescedEvent::ICoalescedEvent;
+
+                template <typename... ArgTypes>
+                void Add(ArgTypes&&... InArgs)
+                {
+                    PayloadType Payload(Forward<ArgTypes>(InArgs)...);
+
+                    if (const int32* Index = PendingIndices.Find(Payload.template Get<0>()))
+                    {
+                        Pending[*Index] = MoveTemp(Payload);
+                    }
+                    else
+                    {
+                        const int32 NewIndex = Pending.Add(MoveTemp(Payload));
+                        PendingIndices.Add(Pending[NewIndex].template Get<0>(), NewIndex);
+                    }
+                }
+
+                virtual void Take() override
+                {
+                    Taken = MoveTemp(Pending);
+                    Pending.Reset();
+                    PendingIndices.Reset();
+                }
+
+                virtual int32 Dispatch(void* InContext) override
+                {
+                    TArray<PayloadType> Payloads = MoveTemp(Taken);
+                    Taken.Reset();
+
+                    for (PayloadType& Payload : Payloads)
+                    {
+                        DispatchFunction(InContext, &Payload);
+                    }
+
+                    return Payloads.Num();
+                }
+
+            private:
+                TArray<PayloadType>     Pending;
+                TMap<KeyType, int32>    PendingIndices;
+                TArray<PayloadType>     Taken;
+            };
+        }
+    }
+}
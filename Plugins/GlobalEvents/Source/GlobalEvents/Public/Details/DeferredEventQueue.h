@@ -0,0 +1,101 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Details/EventObserverAffinity.h"
+
+// priority of a deferred event, see UGameEventSubsystem::Defer
+enum class EGlobalEventPriority : uint8
+{
+    High,
+    Normal,
+    Low
+};
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            /*
+            * Game thread queue of events that are broadcast under a time budget, possibly across several frames.
+            * Events are drained by priority and in order inside a priority,
+            * events that waited longer than the maximum latency of their priority are drained regardless of the budget.
+            */
+            class GLOBALEVENTS_API FDeferredEventQueue
+            {
+            public:
+                typedef void (*FDispatchFunction)(void* InContext, void* InPayload);
+
+                static constexpr int32 NumPriorities = 3;
+
+                template <typename PayloadType, typename... ArgTypes>
+                void Emplace(EGlobalEventPriority InPriority, FDispatchFunction InDispatch, ArgTypes&&... InArgs)
+                {
+                    Push(InPriority, InDispatch, MakeUnique<TEventPayload<PayloadType>>(PayloadType(Forward<ArgTypes>(InArgs)...)));
+                }
+
+                /*
+                * Dispatch the overdue events, then the others until InBudgetSeconds have passed, returns the number of events.
+                * InMaxLatencySeconds is indexed by priority, events deferred by the dispatched observers may be drained by the same call.
+                */
+                int32 Drain(void* InContext, double InBudgetSeconds, const double(&InMaxLatencySeconds)[NumPriorities]);
+
+                // destroy all events without dispatching them
+                void Discard();
+
+                inline int32 Num() const { return NumEvents; }
+
+            private:
+                struct FDeferredEvent
+                {
+                    FDispatchFunction               Dispatch = nullptr;
+                    TUniquePtr<IEventPayload>       Payload;
+                    double                          DeferTime = 0.0;
+                };
+
+                // a FIFO per priority, consumed entries before Head are reclaimed when they are half of the array
+                struct FPriorityQueue
+                {
+                    TArray<FDeferredEvent>          Events;
+                    int32                           Head = 0;
+
+                    inline bool IsEmpty() const { return Head == Events.Num(); }
+                };
+
+                void Push(EGlobalEventPriority InPriority, FDispatchFunction InDispatch, TUniquePtr<IEventPayload>&& InPayload);
+                // returns how long the event has waited until InNow
+                double DispatchFront(void* InContext, FPriorityQueue& InQueue, double InNow);
+
+            private:
+                FPriorityQueue                      Queues[NumPriorities];
+                int32                               NumEvents = 0;
+            };
+        }
+    }
+}
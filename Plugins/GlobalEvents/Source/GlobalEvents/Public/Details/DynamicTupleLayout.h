@@ -0,0 +1,116 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Details/Signature.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            /*
+            * Element offsets, size and alignment of a dynamic tuple, laid out with the same rules as TTuple.
+            * Layouts are cached per signature and per call site for the lifetime of the process.
+            * Tuples only use a cached layout to size their buffer up front and still place every element they push,
+            * so a layout that went stale (hot reload, recompiled blueprint) can at most cost a reallocation.
+            */
+            class GLOBALEVENTS_API FDynamicTupleLayout
+            {
+            public:
+                static constexpr uint32 AlignOffset(uint32 InOffset, uint32 InAlignment)
+                {
+                    return (InOffset + (InAlignment - 1)) & ~(InAlignment - 1);
+                }
+
+                // append an element, returns its offset
+                inline uint32 Add(uint32 InSize, uint32 InAlignment)
+                {
+                    const uint32 Offset = AlignOffset(Size, InAlignment);
+
+                    Offsets.Add(Offset);
+                    Size = Offset + InSize;
+                    Alignment = FMath::Max(Alignment, InAlignment);
+
+                    return Offset;
+                }
+
+                inline void Reset()
+                {
+                    Offsets.Reset();
+                    Size = 0;
+                    Alignment = 1;
+                }
+
+                inline int32 Num() const { return Offsets.Num(); }
+                inline uint32 GetOffset(int32 InIndex) const { return Offsets[InIndex]; }
+                inline uint32 GetSize() const { return Size; }
+                inline uint32 GetAlignment() const { return Alignment; }
+
+                // the cached layout of tuples with this signature, InLayout is stored if there is none yet
+                static const FDynamicTupleLayout* FindOrAdd(const ISignature* InSignature, const FDynamicTupleLayout& InLayout);
+
+                // the layout last built by a named call site, nullptr if it has not completed a tuple yet
+                static const FDynamicTupleLayout* FindCallSite(const FName& InCallSite);
+                static void SetCallSite(const FName& InCallSite, const FDynamicTupleLayout* InLayout);
+
+            private:
+                TArray<uint32, TInlineAllocator<8>>     Offsets;
+                uint32                                  Size = 0;
+                uint32                                  Alignment = 1;
+            };
+
+            // layout of a tuple built from C++ parameters, computed once per parameter list
+            template <typename... ParamTypes>
+            class TDynamicTupleLayout
+            {
+            public:
+                static const FDynamicTupleLayout& Get()
+                {
+                    static const FDynamicTupleLayout* Z_Layout = FDynamicTupleLayout::FindOrAdd(
+                        TGenericSignature<ParamTypes...>::StaticSignature(),
+                        Build()
+                    );
+
+                    return *Z_Layout;
+                }
+
+            private:
+                static FDynamicTupleLayout Build()
+                {
+                    FDynamicTupleLayout Layout;
+
+                    (Layout.Add(sizeof(typename TDecay<ParamTypes>::Type), alignof(typename TDecay<ParamTypes>::Type)), ...);
+
+                    return Layout;
+                }
+            };
+        }
+    }
+}
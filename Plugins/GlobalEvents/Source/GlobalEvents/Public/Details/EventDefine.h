@@ -32,12 +32,33 @@
 template <typename... ParamTypes>
 class TDynamicEventContextFactory;
 
+// how the broadcasts of a type-safe event between two flushes are merged, see DEFINE_COALESCED_TYPESAFE_GLOBAL_EVENT
+enum class EGlobalEventCoalescing : uint8
+{
+    // every broadcast is dispatched immediately
+    None,
+    // only the last broadcast is dispatched
+    LastValue,
+    // the last broadcast of every value of the first parameter is dispatched
+    ByKey
+};
+
 namespace UE 
 {
     namespace GlobalEvents 
     {
         namespace Details
         {
+            /*
+            * Assigns dense ids to type-safe events, events with the same name share an id.
+            */
+            class GLOBALEVENTS_API FTypeSafeEventRegistry
+            {
+            public:
+                static int32 RegisterEvent(const FName& InEventName);
+                static int32 Num();
+            };
+
             /*
             * In addition to using ordinary methods to send events,
             * you can also use the EventDefine mechanism to provide stricter compile-time type safety protection.
@@ -50,8 +71,7 @@ namespace UE
             public:
                 inline static const ISignature* StaticSignature()
                 {
-                    static const TGenericSignature<ParamTypes...> Z_Signature;
-                    return &Z_Signature;
+                    return TGenericSignature<ParamTypes...>::StaticSignature();
                 }
 
                 using FCommonEventObserverType = TCommonEventObserver<ParamTypes...>;
@@ -67,6 +87,14 @@ namespace UE
                 using TObjectMemberFunctionEventObserverType = TBaseUObjectMemberFunctionEventObserver<UserClass, ParamTypes...>;
 
                 using FInvokerType = TSignalInvoker<ParamTypes...>;
+                // whether the arguments of a broadcast may be moved to the observers
+                using FParamOwnershipType = TEventParamOwnership<ParamTypes...>;
+
+                // copy of the parameters of a queued event
+                using FPayloadType = TTuple<typename TDecay<ParamTypes>::Type...>;
+
+                static constexpr EGlobalEventCoalescing Coalescing = EGlobalEventCoalescing::None;
+                static constexpr bool bHasReferenceParameters = THasNonConstLValueReference<ParamTypes...>::Value;
 
                 using FDynamicEventContextFactory = TDynamicEventContextFactory<ParamTypes...>;
 
@@ -74,6 +102,11 @@ namespace UE
                 using TFunctorEventObserverType = TFunctorEventObserver<LambdaExpressionType, ParamTypes...>;
 
             protected:
+                inline static int32 RegisterEventId(const FName& InEventName)
+                {
+                    return FTypeSafeEventRegistry::RegisterEvent(InEventName);
+                }
+
                 // convert _ to .
                 // so we can use it as GameplayTag 
                 inline static FName GetDomainEventName(const char* InInputName)
@@ -94,24 +127,49 @@ namespace UE
     }
 }
 
-/*
-* Use this macro to define your own messages.
-* Note that underscores in names will be replaced with periods.
-* This way it can be expanded into GameplayTags in the future
-*/
-#define DEFINE_TYPESAFE_GLOBAL_EVENT(name, ...)  \
+#define Z_DEFINE_TYPESAFE_GLOBAL_EVENT(name, coalescing, ...)  \
 	class F##name : public UE::GlobalEvents::Details::TEventDefines<__VA_ARGS__> \
 	{ \
 	private: \
 		F##name() = delete; \
 		~F##name() = delete; \
 	public: \
+		static constexpr EGlobalEventCoalescing Coalescing = coalescing; \
 		static const FName& GetEventName() \
 		{ \
 			static const FName Z_Name = GetDomainEventName(#name); \
 			return Z_Name; \
 		} \
-	} 
+		static int32 GetEventId() \
+		{ \
+			return Z_EventId; \
+		} \
+	private: \
+		inline static const int32 Z_EventId = RegisterEventId(GetEventName()); \
+	}
+
+/*
+* Use this macro to define your own messages.
+* Note that underscores in names will be replaced with periods.
+* This way it can be expanded into GameplayTags in the future
+*/
+#define DEFINE_TYPESAFE_GLOBAL_EVENT(name, ...)  \
+	Z_DEFINE_TYPESAFE_GLOBAL_EVENT(name, EGlobalEventCoalescing::None, __VA_ARGS__)
+
+/*
+* Define a message whose type-safe broadcasts are coalesced until the next flush, observers are only called with the last value.
+* Coalesced events are flushed once per frame after the queued events, see UGameEventSubsystem::FlushCoalescedEvents.
+* Broadcasts by name are not coalesced.
+*/
+#define DEFINE_COALESCED_TYPESAFE_GLOBAL_EVENT(name, ...)  \
+	Z_DEFINE_TYPESAFE_GLOBAL_EVENT(name, EGlobalEventCoalescing::LastValue, __VA_ARGS__)
+
+/*
+* Same as DEFINE_COALESCED_TYPESAFE_GLOBAL_EVENT, but the broadcasts are merged by the value of the first parameter,
+* so observers are called once for every key with its last value. The first parameter must be hashable.
+*/
+#define DEFINE_KEYED_COALESCED_TYPESAFE_GLOBAL_EVENT(name, ...)  \
+	Z_DEFINE_TYPESAFE_GLOBAL_EVENT(name, EGlobalEventCoalescing::ByKey, __VA_ARGS__) 
 
 
 
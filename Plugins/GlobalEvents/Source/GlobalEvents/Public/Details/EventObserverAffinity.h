@@ -0,0 +1,114 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "Details/EventObserverInterfaces.h"
+#include "GlobalEventObserverOptions.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include <atomic>
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            // parameters of a delivery, copied once for all observers of a thread
+            class IEventPayload
+            {
+            public:
+                virtual ~IEventPayload() = default;
+
+                virtual const void* Get() const = 0;
+            };
+
+            template <typename TupleType>
+            class TEventPayload : public IEventPayload
+            {
+            public:
+                TEventPayload(TupleType&& InValue) :
+                    Value(MoveTemp(InValue))
+                {
+                }
+
+                virtual const void* Get() const override
+                {
+                    return &Value;
+                }
+
+                static TUniquePtr<IEventPayload> Copy(const void* InParams)
+                {
+                    return MakeUnique<TEventPayload>(TupleType(*(const TupleType*)InParams));
+                }
+
+            private:
+                TupleType Value;
+            };
+
+            typedef TUniquePtr<IEventPayload>(*FCopyEventPayloadFunction)(const void* InParams);
+
+            /*
+            * Thread binding of an observer, see FGlobalEventObserverOptions::Thread.
+            * It owns the heap observer and is shared by the signal and the deliveries in flight,
+            * so a delivery can still check an observer after it was disconnected or its signal was destroyed.
+            */
+            class GLOBALEVENTS_API FEventObserverAffinity
+            {
+            public:
+                typedef TArray<FEventObserverAffinity*, TInlineAllocator<8>> FDeferredList;
+
+                FEventObserverAffinity(IEventObserver* InObserver, const FGlobalEventObserverOptions& InOptions);
+
+                // true when the current thread may call the observer inline
+                bool IsInContext() const;
+
+                // delivered observers are skipped once it is called, the observer itself lives until the last reference is released
+                inline void Disconnect() { bConnected.store(false, std::memory_order_relaxed); }
+
+                void AddRef();
+                void Release();
+
+                // post one delivery per target thread of InDeferred, InMakePayload is called once per delivery
+                static void Deliver(FDeferredList& InDeferred, TFunctionRef<TUniquePtr<IEventPayload>()> InMakePayload);
+
+            private:
+                ~FEventObserverAffinity();
+
+                bool IsSameTarget(const FEventObserverAffinity& InOther) const;
+                void Post(TUniqueFunction<void()>&& InTask) const;
+
+            private:
+                IEventObserver*             Observer;
+                EGlobalEventThread          Thread;
+#if ENGINE_MAJOR_VERSION >= 5
+                UE::Tasks::FPipe*           Pipe;
+#endif
+                std::atomic<int32>          RefCount{ 1 };
+                std::atomic<bool>           bConnected{ true };
+            };
+        }
+    }
+}
@@ -33,6 +33,9 @@ namespace UE
     {
         namespace Details
         {
+            // type erased invoke thunk of a generic observer, see TBaseEventObserver::FInvokeThunkType
+            typedef void (*FEventObserverThunk)();
+
             /*
             * Listener base class for internal use
             */
@@ -42,12 +45,19 @@ namespace UE
                 virtual ~IEventObserver() = default;
 
                 virtual bool EqualTo(const IEventObserver* InOther) const = 0;
+                // hash of target + function, observers that return true with equal hashes may be EqualTo
+                // observers without identity (functors) return false and never compare equal
+                virtual bool GetIdentityHash(uint32& OutHash) const = 0;
                 virtual int GetType() const = 0;
                 virtual bool IsGeneric() const = 0;
-
-                virtual bool IsPendingDestroy() const = 0;
-                virtual void SetPendingDestroy(bool bIsPendingDestroy) = 0;
-                virtual IEventObserver* CloneAndMove() = 0;
+                virtual FEventObserverThunk GetInvokeThunk() const = 0;
+                // same as the invoke thunk, but the value parameters are moved into the observer, see EEventParamOwnership
+                virtual FEventObserverThunk GetConsumeThunk() const = 0;
+
+                // move construct a new observer at the address provided by the owner signal
+                virtual IEventObserver* CloneAndMove(void* InAddress) = 0;
+                virtual SIZE_T GetObjectSize() const = 0;
+                virtual SIZE_T GetObjectAlignment() const = 0;
                 virtual FDelegateHandle GetHandle() const = 0;
 
                 virtual void ExecuteInvoke(const void* InParams) = 0;
@@ -61,15 +71,14 @@ namespace UE
                 FBaseEventObserver(FBaseEventObserver&& InOther) noexcept;
 
                 virtual bool EqualTo(const IEventObserver* InOther) const override;
-                virtual bool IsPendingDestroy() const override;
-                virtual void SetPendingDestroy(bool bIsPendingDestroy) override;
+                virtual bool GetIdentityHash(uint32& OutHash) const override;
                 virtual FDelegateHandle GetHandle() const override;
                 virtual bool IsGeneric() const override;
+                virtual FEventObserverThunk GetInvokeThunk() const override;
+                virtual FEventObserverThunk GetConsumeThunk() const override;
 
             protected:
                 FDelegateHandle     Handle;
-            private:
-                bool                bPendingDestroy = false;
             };
 
             template <typename... ParamTypes>
@@ -79,6 +88,11 @@ namespace UE
                 // don't use std::tuple
                 typedef TTuple<typename TDecay<ParamTypes>::Type...>  ScriptableParamList;
 
+                // signals call generic observers through this thunk, so dispatch doesn't need to load the vtable
+                // values are passed by reference, an observer taking a value copies it when it calls its function
+                typedef void (*FInvokeThunkType)(IEventObserver*, typename TEventParam<ParamTypes>::Type...);
+                typedef void (*FConsumeThunkType)(IEventObserver*, typename TConsumedParam<ParamTypes>::Type...);
+
                 TBaseEventObserver()
                 {
                 }
@@ -97,9 +111,10 @@ namespace UE
                 }
 
             public:
+                // shared by every observer with the same parameters, so observers don't build their own
                 virtual const ISignature* GetSignature() const override
                 {
-                    return &Signature;
+                    return TGenericSignature<ParamTypes...>::StaticSignature();
                 }
 
                 virtual bool IsGeneric() const override
@@ -123,10 +138,7 @@ namespace UE
                     }
                 }
 
-                virtual void Invoke(ParamTypes... InParams) = 0;
-
-            private:
-                TGenericSignature<ParamTypes...>       Signature;
+                virtual void Invoke(typename TEventParam<ParamTypes>::Type... InParams) = 0;
             };
         }
     }
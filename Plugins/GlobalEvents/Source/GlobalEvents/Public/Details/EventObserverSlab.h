@@ -0,0 +1,83 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "Details/EventObserverInterfaces.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            /*
+            * Per-signal storage of observers.
+            * Observers are move-constructed into fixed-size slots that live in chunks,
+            * so all observers of a signal sit next to each other and never move after they are connected.
+            * Observers that don't fit into a slot (for example functors with big captures) fall back to the heap.
+            */
+            class GLOBALEVENTS_API FEventObserverSlab
+            {
+            public:
+                static constexpr SIZE_T SlotSize = 64;
+                static constexpr SIZE_T SlotAlignment = 16;
+                static constexpr int32  SlotsPerChunk = 32;
+
+                FEventObserverSlab();
+                FEventObserverSlab(FEventObserverSlab&& InOther);
+                ~FEventObserverSlab();
+
+                FEventObserverSlab(const FEventObserverSlab&) = delete;
+                FEventObserverSlab& operator = (const FEventObserverSlab&) = delete;
+
+                // move the source observer into this slab
+                // OutSlotIndex will be INDEX_NONE if the observer is allocated from heap
+                IEventObserver* Allocate(IEventObserver* InSource, int32& OutSlotIndex);
+
+                // destroy an observer allocated by this slab
+                void Free(IEventObserver* InInstance, int32 InSlotIndex);
+
+                // move the source observer to the heap, it doesn't depend on any slab, slot index is INDEX_NONE
+                static IEventObserver* AllocateStandalone(IEventObserver* InSource);
+                static void FreeStandalone(IEventObserver* InInstance);
+
+                // release all chunks, all observers must be freed before
+                void Empty();
+
+                inline int32 GetNumUsedSlots() const { return NumUsedSlots - FreeSlots.Num(); }
+                inline SIZE_T GetAllocatedSize() const { return Chunks.Num() * SlotSize * SlotsPerChunk; }
+
+            private:
+                void* GetSlotAddress(int32 InSlotIndex) const;
+
+            private:
+                TArray<uint8*>                  Chunks;
+                TArray<int32>                   FreeSlots;
+                int32                           NumUsedSlots = 0;
+            };
+        }
+    }
+}
@@ -49,13 +49,80 @@ namespace UE
                 EventObserver_Max
             };
 
+            // function pointers and member function pointers are hashed by value
+            template <typename FunctionType>
+            inline uint32 GetFunctionPointerHash(const FunctionType& InFunction)
+            {
+                return FCrc::MemCrc32(&InFunction, sizeof(FunctionType));
+            }
+
+            // the part every generic observer implements the same way, SelfType only provides Call(ArgTypes&&...)
+            // Call forwards its arguments, so the value parameters of the function are moved from them by ConsumeThunk
+            template <typename SelfType, typename... ParamTypes>
+            class TGenericEventObserver : public TBaseEventObserver<ParamTypes...>
+            {
+            public:
+                typedef TBaseEventObserver<ParamTypes...> Super;
+
+                TGenericEventObserver()
+                {
+                }
+
+                TGenericEventObserver(TGenericEventObserver&& InOther) noexcept :
+                    Super(MoveTemp(InOther))
+                {
+                }
+
+                virtual void Invoke(typename TEventParam<ParamTypes>::Type... InParams) override
+                {
+                    static_cast<SelfType*>(this)->Call(InParams...);
+                }
+
+                virtual IEventObserver* CloneAndMove(void* InAddress) override
+                {
+                    return new (InAddress) SelfType(MoveTemp(*static_cast<SelfType*>(this)));
+                }
+
+                virtual SIZE_T GetObjectSize() const override
+                {
+                    return sizeof(SelfType);
+                }
+
+                virtual SIZE_T GetObjectAlignment() const override
+                {
+                    return alignof(SelfType);
+                }
+
+                virtual FEventObserverThunk GetInvokeThunk() const override
+                {
+                    return (FEventObserverThunk)&TGenericEventObserver::InvokeThunk;
+                }
+
+                static void InvokeThunk(IEventObserver* InInstance, typename TEventParam<ParamTypes>::Type... InParams)
+                {
+                    // Call isn't virtual, so it is resolved at compile time
+                    static_cast<SelfType*>(InInstance)->Call(InParams...);
+                }
+
+                virtual FEventObserverThunk GetConsumeThunk() const override
+                {
+                    return (FEventObserverThunk)&TGenericEventObserver::ConsumeThunk;
+                }
+
+                // the value parameters are moved into Call, see EEventParamOwnership
+                static void ConsumeThunk(IEventObserver* InInstance, typename TConsumedParam<ParamTypes>::Type... InParams)
+                {
+                    static_cast<SelfType*>(InInstance)->Call(Forward<typename TConsumedParam<ParamTypes>::Type>(InParams)...);
+                }
+            };
+
             template <typename... ParamTypes>
-            class TCommonEventObserver : public TBaseEventObserver<ParamTypes...>
+            class TCommonEventObserver : public TGenericEventObserver<TCommonEventObserver<ParamTypes...>, ParamTypes...>
             {
             public:
                 typedef void (*FunctionType)(ParamTypes...);
-                typedef TBaseEventObserver<ParamTypes...> Super;
                 typedef TCommonEventObserver<ParamTypes...> SelfType;
+                typedef TGenericEventObserver<SelfType, ParamTypes...> Super;
 
                 TCommonEventObserver(FunctionType CommonFunction) :
                     Function(CommonFunction)
@@ -69,11 +136,12 @@ namespace UE
                     Other.Function = nullptr;
                 }
 
-                virtual void Invoke(ParamTypes... InParams) override
+                template <typename... ArgTypes>
+                void Call(ArgTypes&&... InArgs)
                 {
                     if (Function != nullptr)
                     {
-                        Function(InParams...);
+                        Function(Forward<ArgTypes>(InArgs)...);
                     }
                 }
 
@@ -89,9 +157,10 @@ namespace UE
                         ((const SelfType*)InOther)->Function == this->Function;
                 }
 
-                virtual IEventObserver* CloneAndMove() override
+                virtual bool GetIdentityHash(uint32& OutHash) const override
                 {
-                    return new SelfType(MoveTemp(*this));
+                    OutHash = HashCombine((uint32)EEventObserverType::CommonFunction, GetFunctionPointerHash(Function));
+                    return true;
                 }
 
             private:
@@ -99,12 +168,12 @@ namespace UE
             };
 
             template <typename UserClass, typename... ParamTypes>
-            class TMemberFunctionEventObserver : public TBaseEventObserver<ParamTypes...>
+            class TMemberFunctionEventObserver : public TGenericEventObserver<TMemberFunctionEventObserver<UserClass, ParamTypes...>, ParamTypes...>
             {
             public:
                 typedef void (UserClass::* MemberFunctionType)(ParamTypes...);
-                typedef TBaseEventObserver<ParamTypes...> Super;
                 typedef TMemberFunctionEventObserver<UserClass, ParamTypes...> SelfType;
+                typedef TGenericEventObserver<SelfType, ParamTypes...> Super;
 
                 static_assert(!UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "This class is only valid for non UObject.");
 
@@ -136,16 +205,18 @@ namespace UE
                         ((const SelfType*)InOther)->Function == this->Function;
                 }
 
-                virtual IEventObserver* CloneAndMove() override
+                virtual bool GetIdentityHash(uint32& OutHash) const override
                 {
-                    return new SelfType(MoveTemp(*this));
+                    OutHash = HashCombine(HashCombine((uint32)EEventObserverType::RawMemberFunction, PointerHash(Target)), GetFunctionPointerHash(Function));
+                    return true;
                 }
 
-                virtual void Invoke(ParamTypes... InParams) override
+                template <typename... ArgTypes>
+                void Call(ArgTypes&&... InArgs)
                 {
                     if (Target != nullptr && Function != nullptr)
                     {
-                        (Target->*Function)(InParams...);
+                        (Target->*Function)(Forward<ArgTypes>(InArgs)...);
                     }
                 }
 
@@ -155,12 +226,12 @@ namespace UE
             };
 
             template <typename UserClass, ESPMode Mode, typename... ParamTypes>
-            class TSPMemberFunctionEventObserver : public TBaseEventObserver<ParamTypes...>
+            class TSPMemberFunctionEventObserver : public TGenericEventObserver<TSPMemberFunctionEventObserver<UserClass, Mode, ParamTypes...>, ParamTypes...>
             {
             public:
                 typedef void (UserClass::* MemberFunctionType)(ParamTypes...);
-                typedef TBaseEventObserver<ParamTypes...> Super;
                 typedef TSPMemberFunctionEventObserver<UserClass, Mode, ParamTypes...> SelfType;
+                typedef TGenericEventObserver<SelfType, ParamTypes...> Super;
                 typedef TSharedPtr<UserClass, Mode> UserClassPtr;
 
                 TSPMemberFunctionEventObserver(const UserClassPtr& InTarget, MemberFunctionType InFunc) :
@@ -189,16 +260,18 @@ namespace UE
                         ((const SelfType*)InOther)->Function == this->Function;
                 }
 
-                virtual IEventObserver* CloneAndMove() override
+                virtual bool GetIdentityHash(uint32& OutHash) const override
                 {
-                    return new SelfType(MoveTemp(*this));
+                    OutHash = HashCombine(HashCombine((uint32)EEventObserverType::SPMemberFunction, GetTypeHash(Target)), GetFunctionPointerHash(Function));
+                    return true;
                 }
 
-                virtual void Invoke(ParamTypes... InParams) override
+                template <typename... ArgTypes>
+                void Call(ArgTypes&&... InArgs)
                 {
                     if (Target.IsValid() && Function != nullptr)
                     {
-                        (Target.Pin().Get()->*Function)(InParams...);
+                        (Target.Pin().Get()->*Function)(Forward<ArgTypes>(InArgs)...);
                     }
                 }
 
@@ -208,12 +281,12 @@ namespace UE
             };
 
             template <typename UserClass, typename... ParamTypes>
-            class TBaseUObjectMemberFunctionEventObserver : public TBaseEventObserver<ParamTypes...>
+            class TBaseUObjectMemberFunctionEventObserver : public TGenericEventObserver<TBaseUObjectMemberFunctionEventObserver<UserClass, ParamTypes...>, ParamTypes...>
             {
             public:
                 typedef void (UserClass::* MemberFunctionType)(ParamTypes...);
-                typedef TBaseEventObserver<ParamTypes...> Super;
                 typedef TBaseUObjectMemberFunctionEventObserver<UserClass, ParamTypes...> SelfType;
+                typedef TGenericEventObserver<SelfType, ParamTypes...> Super;
 
                 static_assert(UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "This class is only valid for UObject.");
 
@@ -243,12 +316,14 @@ namespace UE
                         ((const SelfType*)InOther)->Function == this->Function;
                 }
 
-                virtual IEventObserver* CloneAndMove() override
+                virtual bool GetIdentityHash(uint32& OutHash) const override
                 {
-                    return new SelfType(MoveTemp(*this));
+                    OutHash = HashCombine(HashCombine((uint32)EEventObserverType::UObjectMemberFunction, GetTypeHash(Target)), GetFunctionPointerHash(Function));
+                    return true;
                 }
 
-                virtual void Invoke(ParamTypes... InParams) override
+                template <typename... ArgTypes>
+                void Call(ArgTypes&&... InArgs)
                 {
                     // Verify that the user object is still valid.  We only have a weak reference to it.
                     checkSlow(Target.IsValid());
@@ -257,7 +332,7 @@ namespace UE
                     {
                         if (UserClass* ActualUserObject = this->Target.Get())
                         {
-                            (ActualUserObject->*Function)(InParams...);
+                            (ActualUserObject->*Function)(Forward<ArgTypes>(InArgs)...);
                         }
                     }
                 }
@@ -268,11 +343,11 @@ namespace UE
             };
 
             template <typename FunctorType, typename... ParamTypes>
-            class TFunctorEventObserver : public TBaseEventObserver<ParamTypes...>
+            class TFunctorEventObserver : public TGenericEventObserver<TFunctorEventObserver<FunctorType, ParamTypes...>, ParamTypes...>
             {
             public:
-                typedef TBaseEventObserver<ParamTypes...> Super;
                 typedef TFunctorEventObserver<FunctorType, ParamTypes...> SelfType;
+                typedef TGenericEventObserver<SelfType, ParamTypes...> Super;
 
                 TFunctorEventObserver(FunctorType&& InFunctor) :
                     Functor(MoveTemp(InFunctor))
@@ -295,14 +370,10 @@ namespace UE
                     return false;
                 }
 
-                virtual IEventObserver* CloneAndMove() override
-                {
-                    return new SelfType(MoveTemp(*this));
-                }
-
-                virtual void Invoke(ParamTypes... InParams) override
+                template <typename... ArgTypes>
+                void Call(ArgTypes&&... InArgs)
                 {
-                    Functor(InParams...);
+                    Functor(Forward<ArgTypes>(InArgs)...);
                 }
 
             private:
@@ -377,9 +448,25 @@ namespace UE
                         ((const SelfType*)InOther)->FunctionName == this->FunctionName;
                 }
 
-                virtual IEventObserver* CloneAndMove() override
+                virtual bool GetIdentityHash(uint32& OutHash) const override
+                {
+                    OutHash = HashCombine(HashCombine((uint32)EEventObserverType::UFunctionFunction, GetTypeHash(Target)), GetTypeHash(FunctionName));
+                    return true;
+                }
+
+                virtual IEventObserver* CloneAndMove(void* InAddress) override
+                {
+                    return new (InAddress) SelfType(MoveTemp(*this));
+                }
+
+                virtual SIZE_T GetObjectSize() const override
+                {
+                    return sizeof(SelfType);
+                }
+
+                virtual SIZE_T GetObjectAlignment() const override
                 {
-                    return new SelfType(MoveTemp(*this));
+                    return alignof(SelfType);
                 }
 
                 virtual void ExecuteInvoke(const void* InParams) override
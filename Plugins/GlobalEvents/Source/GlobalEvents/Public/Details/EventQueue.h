@@ -0,0 +1,146 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            /*
+            * Multi-producer single-consumer queue of events.
+            * Any thread may enqueue, only one thread at a time drains, events of one producer are drained in order.
+            * Payloads are constructed in place in a ring arena, so enqueue doesn't allocate unless the arena is full.
+            * The queue itself is an intrusive linked list, producers link their records with a single atomic exchange.
+            */
+            class GLOBALEVENTS_API FEventQueue
+            {
+            public:
+                typedef void (*FDispatchFunction)(void* InContext, void* InPayload);
+                typedef void (*FDestroyFunction)(void* InPayload);
+
+                explicit FEventQueue(int32 InArenaSize);
+                ~FEventQueue();
+
+                FEventQueue(const FEventQueue&) = delete;
+                FEventQueue& operator = (const FEventQueue&) = delete;
+
+                // construct a PayloadType in the queue, InDispatch is called with it when the queue is drained
+                template <typename PayloadType, typename... ArgTypes>
+                void Emplace(FDispatchFunction InDispatch, ArgTypes&&... InArgs)
+                {
+                    FRecord* Record = AllocateRecord(sizeof(PayloadType), alignof(PayloadType));
+
+                    new (Record->GetPayload()) PayloadType(Forward<ArgTypes>(InArgs)...);
+
+                    Record->Dispatch = InDispatch;
+                    Record->Destroy = &DestroyPayload<PayloadType>;
+
+                    Push(Record);
+                }
+
+                // consumer only, dispatch the queued events until none is left, returns the number of events
+                // events enqueued by the dispatched observers are dispatched by the same drain
+                int32 Drain(void* InContext);
+
+                // consumer only, destroy all events without dispatching them
+                void Discard();
+
+                // consumer only, Head may be the stub while records are still linked in front of it, see Pop
+                inline bool IsEmpty() const
+                {
+                    return Tail == &Stub && Stub.Next.load(std::memory_order_acquire) == nullptr;
+                }
+
+                inline int32 GetArenaSize() const { return ArenaSize; }
+
+            private:
+                struct FRecord
+                {
+                    std::atomic<FRecord*>   Next{ nullptr };
+                    FDispatchFunction       Dispatch = nullptr;
+                    FDestroyFunction        Destroy = nullptr;
+                    // offset of the payload from the record, 0 for the stub
+                    uint32                  PayloadOffset = 0;
+                    bool                    bInArena = false;
+
+                    inline void* GetPayload()
+                    {
+                        return (uint8*)this + PayloadOffset;
+                    }
+                };
+
+                // header of each arena block, a block is a record or the padding before the arena wraps around
+                // the free part of the arena is zeroed, so a header which is not written yet reads as Empty
+                struct FArenaBlock
+                {
+                    std::atomic<uint32>     State{ 0 };
+                    uint32                  Size = 0;
+                };
+
+                enum EArenaBlockState : uint32
+                {
+                    Empty = 0,
+                    Consumed,
+                    Padding
+                };
+
+                static constexpr uint32 BlockAlignment = 16;
+                static constexpr uint32 BlockHeaderSize = 16;
+
+                template <typename PayloadType>
+                static void DestroyPayload(void* InPayload)
+                {
+                    ((PayloadType*)InPayload)->~PayloadType();
+                }
+
+                FRecord* AllocateRecord(SIZE_T InPayloadSize, SIZE_T InPayloadAlignment);
+                void FreeRecord(FRecord* InRecord);
+                void ReleaseArena();
+
+                void Push(FRecord* InRecord);
+                FRecord* Pop();
+
+            private:
+                // producers
+                std::atomic<FRecord*>   Head;
+                std::atomic<uint64>     ArenaWriteOffset{ 0 };
+
+                // consumer
+                FRecord*                Tail;
+                std::atomic<uint64>     ArenaReadOffset{ 0 };
+
+                FRecord                 Stub;
+                uint8*                  Arena = nullptr;
+                int32                   ArenaSize = 0;
+            };
+        }
+    }
+}
@@ -0,0 +1,79 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        namespace Details
+        {
+            /*
+            * Epoch based reclamation for data that is read without locks.
+            * Readers enter a read scope before they load a published pointer and leave it when they are done with it.
+            * Writers replace the published pointer first and then retire the old data,
+            * it is released once every reader that might still see it has left its read scope.
+            * Entering and leaving a read scope never blocks, read scopes can be nested.
+            */
+            class GLOBALEVENTS_API FReadCopyUpdate
+            {
+            public:
+                static void EnterRead();
+                static void LeaveRead();
+
+                // InDeleter is called once no reader can reference the retired data, maybe on another thread
+                static void Retire(TUniqueFunction<void()>&& InDeleter);
+
+                // release the retired data whose readers have left
+                static void Reclaim();
+
+                // wait for all readers and release everything retired so far, must not be called inside a read scope
+                static void Synchronize();
+
+                static int32 GetNumRetired();
+            };
+
+            struct FReadScope
+            {
+                FReadScope()
+                {
+                    FReadCopyUpdate::EnterRead();
+                }
+
+                ~FReadScope()
+                {
+                    FReadCopyUpdate::LeaveRead();
+                }
+
+                FReadScope(const FReadScope&) = delete;
+                FReadScope& operator = (const FReadScope&) = delete;
+            };
+        }
+    }
+}
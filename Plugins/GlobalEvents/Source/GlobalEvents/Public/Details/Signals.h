@@ -27,12 +27,20 @@
 
 #include "GlobalEventsLog.h"
 #include "Details/EventObserverInterfaces.h"
+#include "Details/EventObserverSlab.h"
+#include "Details/EventObserverAffinity.h"
+#include "Details/ReadCopyUpdate.h"
 #include "SignalInterface.h"
+#include "GlobalEventObserverOptions.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
 
 namespace UE
 {
     namespace GlobalEvents
     {
+        class FDynamicTuple;
+
         namespace Details
         {
             class IEventObserver;
@@ -43,49 +51,165 @@ namespace UE
                 Dynamic
             };
 
+            enum class EEventObserverEntryFlags : uint8
+            {
+                None = 0,
+                PendingDestroy = 1 << 0,
+                ConcurrentSafe = 1 << 1
+            };
+
+            ENUM_CLASS_FLAGS(EEventObserverEntryFlags);
+
+            // dispatch record of a connected observer, the observer itself lives in the signal's slab
+            // generic observers are called through Thunk with Observer as context, others through the vtable
+            // observers bound to a thread are owned by their Affinity instead, see FGlobalEventObserverOptions::Thread
+            struct FEventObserverEntry
+            {
+                FEventObserverThunk         Thunk = nullptr;
+                IEventObserver*             Observer = nullptr;
+                FEventObserverAffinity*     Affinity = nullptr;
+                int32                       SlotIndex = INDEX_NONE;
+                EEventObserverEntryFlags    Flags = EEventObserverEntryFlags::None;
+
+                inline bool IsPendingDestroy() const
+                {
+                    return EnumHasAnyFlags(Flags, EEventObserverEntryFlags::PendingDestroy);
+                }
+
+                inline bool IsConcurrentSafe() const
+                {
+                    return EnumHasAnyFlags(Flags, EEventObserverEntryFlags::ConcurrentSafe);
+                }
+            };
+
             class GLOBALEVENTS_API FBaseSignal : public ISignal
             {
             public:
-                typedef TArray<TSharedPtr<IEventObserver>>      DelegateListType;
+                typedef TArray<FEventObserverEntry>             DelegateListType;
                 FBaseSignal();
                 FBaseSignal(FBaseSignal&& InSignal);
+                virtual ~FBaseSignal();
 
                 virtual bool IsLocked() const override;
                 virtual void DisconnectAll() override;
                 virtual FDelegateHandle Connect(IEventObserver* InInstance) override;
+                FDelegateHandle Connect(IEventObserver* InInstance, const FGlobalEventObserverOptions& InOptions);
                 virtual bool Disconnect(IEventObserver* InInstance) override;
                 virtual bool Disconnect(FDelegateHandle InHandle) override;
                 virtual bool IsEmpty() const override;
                 virtual int  Num() const override;
 
+                // lock free, may be stale by the connects and disconnects racing with it on other threads
+                inline bool HasObservers() const { return NumObservers.load(std::memory_order_relaxed) > 0; }
+
+                // memory owned by the signal for its observers, heap fallbacks of big observers are not included
+                SIZE_T GetAllocatedSize() const;
+
+                // same as GetSignature()->CheckInvokeableFrom, the last accepted invoker signature is cached
+                // the cache is a single word, so concurrent dispatches may update it without a lock
+                // a cache miss takes the read lock of FSignatureRegistry
+                inline bool CheckInvokeableFromStatic(const ISignature* InInvokerSignature)
+                {
+                    if (VerifiedInvoker.load(std::memory_order_relaxed) == MakeVerifiedInvoker(InInvokerSignature))
+                    {
+                        return true;
+                    }
+
+                    return CheckInvokeableFromStaticSlow(InInvokerSignature);
+                }
+
+                /*
+                * Observers of a concurrent signal are published as immutable snapshots, see FReadCopyUpdate.
+                * Dispatch only takes a lock on a miss of the signature verdict cache and may run on any thread, connect and disconnect are serialized by a writer lock.
+                * An observer disconnected during a dispatch on another thread may still be called by that dispatch.
+                * It must be enabled before the first observer is connected.
+                */
+                void EnableConcurrentDispatch();
+                inline bool IsConcurrentDispatch() const { return bConcurrentDispatch; }
+
             private:
-                template <typename DisconnectEvaluatorType>
-                bool DisconnectImpl(DisconnectEvaluatorType&& InEvaluator);
+                static inline uint64 MakeVerifiedInvoker(const ISignature* InInvokerSignature)
+                {
+                    return ((uint64)FSignatureCompatibilityEpoch::Get() << 32) | (uint32)InInvokerSignature->GetId();
+                }
 
-                void Lock();
+                bool CheckInvokeableFromStaticSlow(const ISignature* InInvokerSignature);
+                bool CheckObserverCompatible(const IEventObserver* InInstance);
+
+                // true when the concurrent-safe observers of a dispatch are worth fanning out, see GlobalEvents.ParallelDispatchThreshold
+                static bool ShouldDispatchInParallel(int32 InNumConcurrentSafe);
+                // runs InSerialWork on the calling thread while batches of [0, InNum) are processed by the task graph, returns when all are done
+                static void DispatchInParallel(int32 InNum, TFunctionRef<void(int32, int32)> InBatch, TFunctionRef<void()> InSerialWork);
+
+                // returns false when the dispatch depth limit is reached, see GlobalEvents.MaxDispatchDepth
+                bool Lock();
                 void UnLock();
 
+                // tombstone the entry, it is kept in Targets until the next compaction so other indices stay valid
+                void RemoveTarget(int32 InIndex);
+                void Compact();
+                bool ShouldCompact() const;
+
+                // index of the live entry which is EqualTo InInstance, or INDEX_NONE
+                int32 FindEqualTarget(const IEventObserver* InInstance, uint32 InIdentityHash) const;
+
+                // free the observer of a removed entry, concurrent signals defer it until the readers have left
+                void ReleaseObserver(const FEventObserverEntry& InEntry);
+                void FreeObserver(const FEventObserverEntry& InEntry);
+                static void FreeStandaloneObserver(const FEventObserverEntry& InEntry);
+
+                void ExecuteEntries(const DelegateListType& InEntries, int32 InNum, const void* InParams, FCopyEventPayloadFunction InCopyPayload, const void* InPayloadSource);
+
+                // index of the observer which takes the values of an owned broadcast, or INDEX_NONE
+                // it is the last generic observer, or the first of the script observers which end the list since they share one tuple
+                static int32 FindConsumerIndex(const DelegateListType& InEntries, int32 InNum);
+
+                void PublishObservers();
+
+                // serializes writers of a concurrent signal and publishes the changed observers when it ends
+                struct FWriteScope
+                {
+                    FBaseSignal* Owner;
+
+                    FWriteScope(FBaseSignal* InOwner);
+                    ~FWriteScope();
+                };
+
+                struct FEventObserverSnapshot
+                {
+                    DelegateListType Entries;
+                    int32 NumConcurrentSafe = 0;
+                };
+
             protected:
                 inline bool IsTargetsEmpty() const { return Targets.Num() == 0; }
 
+                // InCopyPayload copies InPayloadSource for observers bound to another thread, they are called inline without it
+                // InPayloadSource is InParams unless they belong to another object, like the buffer of a FDynamicTuple
+                void ExecuteRaiseEventInternal(const void* InParams, FCopyEventPayloadFunction InCopyPayload, const void* InPayloadSource);
+
                 struct GLOBALEVENTS_API FUnLockHelper
                 {
                     FBaseSignal* Owner;
+                    const bool   bLocked;
 
                     FUnLockHelper(FBaseSignal* InOwner) :
-                        Owner(InOwner)
+                        Owner(InOwner),
+                        bLocked(InOwner->Lock())
                     {
-                        Owner->Lock();
                     }
 
                     ~FUnLockHelper()
                     {
-                        Owner->UnLock();
+                        if (bLocked)
+                        {
+                            Owner->UnLock();
+                        }
                     }
                 };
 
 				template <SIZE_T Index, typename TTupleType, typename T, typename... ParamTypes>
-                void MoveLeftReferenceBack(TTupleType& InTempTupleRef, T ValueRef, ParamTypes... InParams)
+                void MoveLeftReferenceBack(TTupleType& InTempTupleRef, typename TEventParam<T>::Type ValueRef, typename TEventParam<ParamTypes>::Type... InParams)
 				{
 					if constexpr (TIsNonConstLValueReference<T>::Value)
 					{
@@ -98,9 +222,35 @@ namespace UE
 					}
 				}
 
+                // the values of InParams are moved from when InOwnership is Owned, see EEventParamOwnership
+                template <typename T>
+                static inline typename TConsumedParam<T>::Type ConsumeParam(typename TEventParam<T>::Type InParam)
+                {
+                    if constexpr (TIsReferenceType<T>::Value)
+                    {
+                        return InParam;
+                    }
+                    else
+                    {
+                        return static_cast<T&&>(const_cast<T&>(InParam));
+                    }
+                }
+
                 template <typename... ParamTypes>
-                void RaiseEventInternal(ParamTypes... InParams)
+                void RaiseEventInternal(EEventParamOwnership InOwnership, typename TEventParam<ParamTypes>::Type... InParams)
                 {
+                    if (IsConcurrentDispatch())
+                    {
+                        FReadScope ReadScope;
+
+                        if (const FEventObserverSnapshot* Snapshot = PublishedObservers.load(std::memory_order_acquire))
+                        {
+                            InvokeEntries<ParamTypes...>(Snapshot->Entries, Snapshot->Entries.Num(), Snapshot->NumConcurrentSafe, InOwnership, InParams...);
+                        }
+
+                        return;
+                    }
+
                     if (IsTargetsEmpty())
                     {
                         return;
@@ -108,21 +258,82 @@ namespace UE
 
                     FUnLockHelper Helper(this);
 
+                    if (!Helper.bLocked)
+                    {
+                        return;
+                    }
+
+                    // observers connected during this dispatch are not called by it
+                    InvokeEntries<ParamTypes...>(Targets, Targets.Num(), NumConcurrentSafeTargets, InOwnership, InParams...);
+                }
+
+                template <typename... ParamTypes>
+                void InvokeEntries(const DelegateListType& InEntries, int32 InNum, int32 InNumConcurrentSafe, EEventParamOwnership InOwnership, typename TEventParam<ParamTypes>::Type... InParams)
+                {
+                    // reference parameters are written back between observers, so such events are always dispatched serially
+                    if constexpr (!THasNonConstLValueReference<ParamTypes...>::Value)
+                    {
+                        if (ShouldDispatchInParallel(InNumConcurrentSafe))
+                        {
+                            InvokeEntriesInParallel<ParamTypes...>(InEntries, InNum, InNumConcurrentSafe, InParams...);
+
+                            return;
+                        }
+                    }
+
                     TOptional<TTuple<typename TDecay<ParamTypes>::Type...>> Stack;
+                    FEventObserverAffinity::FDeferredList Deferred;
 
                     constexpr bool bNeedWriteBack = THasNonConstLValueReference<ParamTypes...>::Value;
                     bool MaybeChanged = false;
 
-                    for (int32 i = 0; i < Targets.Num(); ++i)
+                    // only values which are expensive to copy are worth moving
+                    constexpr bool bCanConsume = !bNeedWriteBack && std::disjunction_v<std::bool_constant<!TIsReferenceType<ParamTypes>::Value && !std::is_trivially_copyable_v<ParamTypes>>...>;
+                    int32 ConsumerIndex = INDEX_NONE;
+
+                    if constexpr (bCanConsume)
                     {
-                        // don't use reference here
-                        auto Instance = Targets[i];
+                        if (InOwnership == EEventParamOwnership::Owned)
+                        {
+                            ConsumerIndex = FindConsumerIndex(InEntries, InNum);
+                        }
+                    }
 
-                        if (!Instance->IsPendingDestroy())
+                    for (int32 i = 0; i < InNum; ++i)
+                    {
+                        // copy the entry, observers never move inside the slab but Targets may grow during dispatch
+                        const FEventObserverEntry Entry = InEntries[i];
+
+                        if constexpr (bCanConsume)
                         {
-                            if (Instance->IsGeneric())
+                            // the values are moved from here on, the observers bound to another thread copy them first
+                            if (i == ConsumerIndex && Deferred.Num() > 0)
                             {
-                                ((TBaseEventObserver<ParamTypes...>*)Instance.Get())->Invoke(InParams...);
+                                DeliverDeferred<ParamTypes...>(Deferred, InParams...);
+                                Deferred.Reset();
+                            }
+                        }
+
+                        if (!Entry.IsPendingDestroy())
+                        {
+                            // observers bound to another thread are delivered after the others
+                            if (Entry.Affinity != nullptr && !Entry.Affinity->IsInContext())
+                            {
+                                Deferred.Add(Entry.Affinity);
+                            }
+                            else if (Entry.Thunk != nullptr)
+                            {
+                                if constexpr (bCanConsume)
+                                {
+                                    if (i == ConsumerIndex)
+                                    {
+                                        ((typename TBaseEventObserver<ParamTypes...>::FConsumeThunkType)Entry.Observer->GetConsumeThunk())(Entry.Observer, ConsumeParam<ParamTypes>(InParams)...);
+
+                                        continue;
+                                    }
+                                }
+
+                                ((typename TBaseEventObserver<ParamTypes...>::FInvokeThunkType)Entry.Thunk)(Entry.Observer, InParams...);
 
                                 MaybeChanged = bNeedWriteBack;
                             }
@@ -130,10 +341,17 @@ namespace UE
                             {
                                 if ((bNeedWriteBack && MaybeChanged) || !Stack.IsSet())
                                 {
-                                    Stack = TTuple<typename TDecay<ParamTypes>::Type...>{ InParams... };
+                                    if (ConsumerIndex != INDEX_NONE && i >= ConsumerIndex)
+                                    {
+                                        Stack.Emplace(ConsumeParam<ParamTypes>(InParams)...);
+                                    }
+                                    else
+                                    {
+                                        Stack = TTuple<typename TDecay<ParamTypes>::Type...>{ InParams... };
+                                    }
                                 }
 
-                                Instance.Get()->ExecuteInvoke(&Stack.GetValue());
+                                Entry.Observer->ExecuteInvoke(&Stack.GetValue());
 
                                 if constexpr (bNeedWriteBack)
                                 {
@@ -148,11 +366,145 @@ namespace UE
                             }
                         }
                     }
+
+                    if (Deferred.Num() > 0)
+                    {
+                        DeliverDeferred<ParamTypes...>(Deferred, InParams...);
+                    }
+                }
+
+                template <typename... ParamTypes>
+                static void DeliverDeferred(FEventObserverAffinity::FDeferredList& InDeferred, typename TEventParam<ParamTypes>::Type... InParams)
+                {
+                    typedef TTuple<typename TDecay<ParamTypes>::Type...> FPayloadTupleType;
+
+                    FEventObserverAffinity::Deliver(InDeferred, [&]() -> TUniquePtr<IEventPayload>
+                        {
+                            return MakeUnique<TEventPayload<FPayloadTupleType>>(FPayloadTupleType{ InParams... });
+                        }
+                    );
+                }
+
+                // concurrent-safe observers run on the task graph while the others run here in order, see FGlobalEventObserverOptions
+                template <typename... ParamTypes>
+                void InvokeEntriesInParallel(const DelegateListType& InEntries, int32 InNum, int32 InNumConcurrentSafe, typename TEventParam<ParamTypes>::Type... InParams)
+                {
+                    // the tasks read their own copy, serial observers may connect others and grow InEntries meanwhile
+                    // observers removed meanwhile are only freed after the join, so the copy stays valid
+                    TArray<FEventObserverEntry> ConcurrentEntries;
+                    ConcurrentEntries.Reserve(InNumConcurrentSafe);
+
+                    // observers without a thunk, e.g. script observers, read the parameters from a tuple
+                    bool bNeedStack = false;
+
+                    for (int32 i = 0; i < InNum; ++i)
+                    {
+                        const FEventObserverEntry& Entry = InEntries[i];
+
+                        if (Entry.IsPendingDestroy())
+                        {
+                            continue;
+                        }
+
+                        bNeedStack |= Entry.Thunk == nullptr;
+
+                        if (Entry.IsConcurrentSafe())
+                        {
+                            ConcurrentEntries.Add(Entry);
+                        }
+                    }
+
+                    // nothing is written back, so all observers share one read-only copy of the parameters
+                    // it is built before the tasks start because they may read it at the same time
+                    TOptional<TTuple<typename TDecay<ParamTypes>::Type...>> Stack;
+
+                    if (bNeedStack)
+                    {
+                        Stack.Emplace(InParams...);
+                    }
+
+                    auto InvokeEntry = [&](const FEventObserverEntry& InEntry)
+                    {
+                        if (InEntry.Thunk != nullptr)
+                        {
+                            ((typename TBaseEventObserver<ParamTypes...>::FInvokeThunkType)InEntry.Thunk)(InEntry.Observer, InParams...);
+                        }
+                        else
+                        {
+                            InEntry.Observer->ExecuteInvoke(&Stack.GetValue());
+                        }
+                    };
+
+                    FEventObserverAffinity::FDeferredList Deferred;
+
+                    DispatchInParallel(ConcurrentEntries.Num(),
+                        [&](int32 InBegin, int32 InEnd)
+                        {
+                            for (int32 i = InBegin; i < InEnd; ++i)
+                            {
+                                InvokeEntry(ConcurrentEntries[i]);
+                            }
+                        },
+                        [&]()
+                        {
+                            for (int32 i = 0; i < InNum; ++i)
+                            {
+                                const FEventObserverEntry Entry = InEntries[i];
+
+                                if (Entry.IsConcurrentSafe() || Entry.IsPendingDestroy())
+                                {
+                                    continue;
+                                }
+
+                                if (Entry.Affinity != nullptr && !Entry.Affinity->IsInContext())
+                                {
+                                    Deferred.Add(Entry.Affinity);
+                                }
+                                else
+                                {
+                                    InvokeEntry(Entry);
+                                }
+                            }
+                        }
+                    );
+
+                    if (Deferred.Num() > 0)
+                    {
+                        DeliverDeferred<ParamTypes...>(Deferred, InParams...);
+                    }
                 }
             protected:
                 DelegateListType                            Targets;
             private:
-                bool                                        LockedFlag = false;
+                FEventObserverSlab                          Slab;
+
+                // handle -> index of live entries in Targets, handles are never reused so no generation is needed
+                TMap<FDelegateHandle, int32>                HandleIndices;
+                // identity hash -> handle of live entries, used to find duplicates without comparing every observer
+                TMultiMap<uint32, FDelegateHandle>          IdentityHandles;
+                int32                                       NumTombstones = 0;
+                // live entries flagged ConcurrentSafe
+                int32                                       NumConcurrentSafeTargets = 0;
+                // live entries, readable without the writer lock, see HasObservers
+                std::atomic<int32>                          NumObservers{ 0 };
+                // frame in which the oldest tombstone was created
+                uint64                                      TombstoneFrame = 0;
+
+                // last verified static signatures, see CheckInvokeableFromStatic
+                std::atomic<uint64>                         VerifiedInvoker{ 0 };
+                const ISignature*                           VerifiedObserverSignature = nullptr;
+                uint32                                      VerifiedObserverEpoch = 0;
+
+                // number of dispatches in flight, observers removed during dispatch are reclaimed when it drops to zero
+                int32                                       DispatchDepth = 0;
+
+                // concurrent dispatch only, see EnableConcurrentDispatch
+                mutable FCriticalSection                    WriterLock;
+                std::atomic<FEventObserverSnapshot*>        PublishedObservers{ nullptr };
+                // observers removed since the last publish, they are retired together with the old snapshot
+                TArray<FEventObserverEntry>                 RemovedObservers;
+                bool                                        bObserversChanged = false;
+                bool                                        bConcurrentDispatch = false;
             };
 
             template <typename... ParamTypes>
@@ -173,8 +525,7 @@ namespace UE
 
                 static const ISignature* StaticSignature()
                 {
-                    static const TGenericSignature<ParamTypes...> Z_StaticSignature;
-                    return &Z_StaticSignature;
+                    return TGenericSignature<ParamTypes...>::StaticSignature();
                 }
 
                 virtual int GetInvokeType() const override
@@ -182,30 +533,20 @@ namespace UE
                     return (int)ESignalInvokeType::Static;
                 }
 
-                void RaiseEvent(ParamTypes... InParams)
+                void RaiseEvent(typename TEventParam<ParamTypes>::Type... InParams)
                 {
-                    Super::template RaiseEventInternal<ParamTypes...>(InParams...);
+                    Super::template RaiseEventInternal<ParamTypes...>(EEventParamOwnership::Borrowed, InParams...);
                 }
 
-                virtual void ExecuteRaiseEvent(const void* InParams) override
+                // the last observers which can take the values get them moved when InOwnership is Owned
+                void RaiseEvent(EEventParamOwnership InOwnership, typename TEventParam<ParamTypes>::Type... InParams)
                 {
-                    if (IsTargetsEmpty())
-                    {
-                        return;
-                    }
-
-                    FUnLockHelper Helper(this);
-
-                    for (int32 i = 0; i < Targets.Num(); ++i)
-                    {
-                        // don't use reference here
-                        auto Instance = Targets[i];
+                    Super::template RaiseEventInternal<ParamTypes...>(InOwnership, InParams...);
+                }
 
-                        if (!Instance->IsPendingDestroy())
-                        {
-                            (Instance.Get())->ExecuteInvoke(InParams);
-                        }
-                    }
+                virtual void ExecuteRaiseEvent(const void* InParams) override
+                {
+                    ExecuteRaiseEventInternal(InParams, &TEventPayload<TTuple<typename TDecay<ParamTypes>::Type...>>::Copy, InParams);
                 }
             };
 
@@ -218,11 +559,14 @@ namespace UE
                 FBaseDynamicSignal(FBaseDynamicSignal&& InSignal);
 
                 template <typename... ParamTypes>
-                void RaiseEvent(ParamTypes... InParams)
+                void RaiseEvent(EEventParamOwnership InOwnership, typename TEventParam<ParamTypes>::Type... InParams)
                 {
-                    FBaseSignal::template RaiseEventInternal<ParamTypes...>(InParams...);
+                    FBaseSignal::template RaiseEventInternal<ParamTypes...>(InOwnership, InParams...);
                 }
 
+                // unlike ExecuteRaiseEvent the tuple can be copied, so observers bound to another thread are called there
+                void RaiseDynamicEvent(const FDynamicTuple& InParams);
+
                 virtual int GetInvokeType() const override;
                 virtual void ExecuteRaiseEvent(const void* InParams) override;
             };
@@ -261,20 +605,43 @@ namespace UE
             class TSignalInvoker
             {
             public:
-                static bool Invoke(TSharedPtr<ISignal> InSignal, const FName& InEventName, ParamTypes... InParams)
+                static bool Invoke(const TSharedPtr<ISignal>& InSignal, const FName& InEventName, typename TEventParam<ParamTypes>::Type... InParams)
+                {
+                    // InSignal may reference the event map of the owner, keep the signal alive during dispatch
+                    const TSharedPtr<ISignal> PinnedSignal = InSignal;
+
+                    return Invoke(PinnedSignal.Get(), InEventName, InParams...);
+                }
+
+                // the caller keeps InSignal alive during dispatch
+                static bool Invoke(ISignal* InSignal, const FName& InEventName, typename TEventParam<ParamTypes>::Type... InParams)
+                {
+                    return Invoke(InSignal, InEventName, EEventParamOwnership::Borrowed, InParams...);
+                }
+
+                // InOwnership is Owned when the values of InParams are temporaries of the broadcast, see EEventParamOwnership
+                static bool Invoke(ISignal* InSignal, const FName& InEventName, EEventParamOwnership InOwnership, typename TEventParam<ParamTypes>::Type... InParams)
                 {
-                    if (InSignal)
+                    if (InSignal != nullptr)
                     {
-                        static const TGenericSignature<ParamTypes...> s_Signature;
+                        const ISignature* BroadcastSignature = TGenericSignature<ParamTypes...>::StaticSignature();
+
+                        // only a TSignal of exactly these parameters shares the static signature
+                        if (InSignal->GetSignature() == BroadcastSignature)
+                        {
+                            static_cast<UE::GlobalEvents::Details::TSignal<ParamTypes...>*>(InSignal)->RaiseEvent(InOwnership, InParams...);
+
+                            return true;
+                        }
 
                         // exists signal's parameters must be convertible from broadcast parameters
-                        if (!InSignal->GetSignature()->CheckInvokeableFrom(&s_Signature))
+                        if (!static_cast<UE::GlobalEvents::Details::FBaseSignal*>(InSignal)->CheckInvokeableFromStatic(BroadcastSignature))
                         {
                             UE_LOG(GlobalEventsLog, Error,
                                 TEXT("Invalid Operation, failed convert signature. EventName = (%s), Signal Signature = (%s), Broadcast Signature = (%s)"),
                                 *InEventName.ToString(),
                                 *InSignal->GetSignature()->ToString(),
-                                *s_Signature.ToString()
+                                *BroadcastSignature->ToString()
                             );
 
                             return false;
@@ -282,15 +649,11 @@ namespace UE
 
                         if (InSignal->GetInvokeType() == (int)UE::GlobalEvents::Details::ESignalInvokeType::Static)
                         {
-                            TSharedPtr<UE::GlobalEvents::Details::TSignal<ParamTypes...>> Signal = StaticCastSharedPtr<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InSignal);
-
-                            Signal->RaiseEvent(InParams...);
+                            static_cast<UE::GlobalEvents::Details::TSignal<ParamTypes...>*>(InSignal)->RaiseEvent(InOwnership, InParams...);
                         }
                         else
                         {
-                            TSharedPtr<UE::GlobalEvents::Details::FBaseDynamicSignal> Signal = StaticCastSharedPtr< UE::GlobalEvents::Details::FBaseDynamicSignal>(InSignal);
-
-                            Signal->template RaiseEvent<ParamTypes...>(InParams...);
+                            static_cast<UE::GlobalEvents::Details::FBaseDynamicSignal*>(InSignal)->template RaiseEvent<ParamTypes...>(InOwnership, InParams...);
                         }
 
                         return true;
@@ -27,6 +27,7 @@
 
 #include "Details/TypeInfo.h"
 #include "SignatureInterface.h"
+#include <atomic>
 
 namespace UE
 {
@@ -34,6 +35,38 @@ namespace UE
     {
         namespace Details
         {
+            /*
+            * Callers may cache the verdicts of CheckInvokeableFrom.
+            * The epoch is advanced whenever types may have changed (hot reload, classes unloaded by GC),
+            * a cached verdict is only valid for the epoch in which it was computed.
+            * It is read by concurrent broadcasts on any thread.
+            */
+            class GLOBALEVENTS_API FSignatureCompatibilityEpoch
+            {
+            public:
+                static inline uint32 Get() { return Value.load(std::memory_order_acquire); }
+                static void Advance();
+
+            private:
+                static std::atomic<uint32> Value;
+            };
+
+            /*
+            * Interns structurally distinct parameter lists into dense ids.
+            * Compatibility verdicts between two ids are memoized in a bit matrix, which is reset when the epoch advances.
+            * The object types of the interned parameters are resolved again by path when a verdict is computed in a new epoch.
+            */
+            class GLOBALEVENTS_API FSignatureRegistry
+            {
+            public:
+                static int32 Intern(const TArray<FGlobalEventParamType>& InParameters, const FName& InName);
+
+                // same as CheckInvokeableFrom of the signatures with these ids
+                static bool CheckInvokeable(int32 InTargetId, int32 InInvokerId);
+
+                static int32 Num();
+            };
+
             class GLOBALEVENTS_API FBaseSignature : public ISignature
             {
             public:
@@ -44,6 +77,7 @@ namespace UE
                 FBaseSignature& operator = (FBaseSignature&& InBaseSignature);
 
                 virtual const FName& GetName() const override;
+                virtual int32 GetId() const override;
                 virtual bool EqualTo(const ISignature* InOtherSignature) const override;
                 virtual const TArray<FGlobalEventParamType>& GetParameters() const override;
                 virtual bool CheckInvokeableFrom(const ISignature* InInvokerSignature) const override;
@@ -81,12 +115,17 @@ namespace UE
                 }
 
             protected:
-                bool EqualToSlowAndSafe(const ISignature* InOtherSignature) const;
-                bool EqualToFast(const ISignature* InOtherSignature) const;
+                // must be called after Parameters changed
+                inline void ResetId() { Id.store(INDEX_NONE, std::memory_order_relaxed); }
 
             protected:
-                FName                          Signature;
+                // built lazily by dynamic signatures
+                mutable FName                  Signature;
                 TArray<FGlobalEventParamType>  Parameters;
+
+            private:
+                // resolved from FSignatureRegistry on first use, static signatures are shared between threads
+                mutable std::atomic<int32>     Id{ INDEX_NONE };
             };
 
             class GLOBALEVENTS_API FDynamicSignature : public FBaseSignature
@@ -102,6 +141,10 @@ namespace UE
 
                 virtual bool IsValid() const override;
 
+                // the name is only built when asked for, adding parameters does not touch the name table
+                virtual const FName& GetName() const override;
+                virtual void Clear() override;
+
             public:
                 template <typename T>
                 void Add()
@@ -112,10 +155,12 @@ namespace UE
                 void Add(const FGlobalEventParamType& InParamType);
                 void Add(FGlobalEventParamType&& InParamType);
 
+                inline void Reserve(int32 InNum) { Parameters.Reserve(InNum); }
+
                 inline const FGlobalEventParamType& GetParamType(int InIndex) const { return Parameters[InIndex]; }
 
             private:
-                void AppendTypeString(const FName& InTypeName);
+                mutable bool                   bNameOutdated = false;
             };
 
             template <typename... ParamTypes>
@@ -127,10 +172,20 @@ namespace UE
                 TGenericSignature()
                 {
                     Signature = *BuildSignature();
+
+                    // resolve now, static signatures may be shared between threads
+                    GetId();
                 }
 
                 virtual bool IsValid() const override { return true; }
 
+                // process-wide shared instance, prefer it to constructing new signatures
+                static const ISignature* StaticSignature()
+                {
+                    static const TGenericSignature<ParamTypes...> Z_Signature;
+                    return &Z_Signature;
+                }
+
             private:
                 template <typename T, typename... ExtraParamTypes>
                 void AppendTypeInfo(FString& InTarget)
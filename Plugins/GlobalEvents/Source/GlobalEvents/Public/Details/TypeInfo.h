@@ -496,6 +496,51 @@ namespace UE
             {
                 static constexpr bool Value = std::disjunction_v<TIsNonConstLValueReference<ParamTypes>...>;
             };
+
+            // how a parameter is passed down the dispatch, values are bound once by the broadcast and only copied by observers taking a value
+            template <typename T>
+            struct TEventParam
+            {
+                typedef std::conditional_t<TIsReferenceType<T>::Value, T, const T&> Type;
+            };
+
+            // how a parameter is passed to the observer which consumes the parameters of a broadcast, values are moved to it
+            template <typename T>
+            struct TConsumedParam
+            {
+                typedef std::conditional_t<TIsReferenceType<T>::Value, T, T&&> Type;
+            };
+
+            // whether the values bound by a broadcast may be moved to its observers, see FBaseSignal::InvokeEntries
+            enum class EEventParamOwnership : uint8
+            {
+                // the caller still uses the arguments after the broadcast
+                Borrowed,
+                // the arguments are temporaries of the broadcast, the last observers which can take them get them moved
+                Owned
+            };
+
+            // an argument is owned by the broadcast when it is an rvalue, or when moving its parameter can't change the caller's value
+            // scalars are converted through a temporary, references and trivially copyable values are never really moved from
+            template <typename ParamType, typename ArgType>
+            struct TIsOwnedEventArg
+            {
+                static constexpr bool value = TIsReferenceType<ParamType>::Value
+                    || std::is_trivially_copyable_v<ParamType>
+                    || std::is_scalar_v<typename TDecay<ArgType>::Type>
+                    || (!TIsLValueReferenceType<ArgType>::Value && !TIsConst<typename TRemoveReference<ArgType>::Type>::Value);
+            };
+
+            template <typename... ParamTypes>
+            struct TEventParamOwnership
+            {
+                // ArgTypes are the forwarding types of the broadcast arguments
+                template <typename... ArgTypes>
+                static constexpr EEventParamOwnership From()
+                {
+                    return std::conjunction_v<TIsOwnedEventArg<ParamTypes, ArgTypes>...> ? EEventParamOwnership::Owned : EEventParamOwnership::Borrowed;
+                }
+            };
         }
     }
 }
@@ -38,6 +38,8 @@ UCLASS(BlueprintType)
 class GLOBALEVENTS_API UDynamicEventContext : public UObject
 {
     GENERATED_BODY()
+
+	friend class UDynamicEventFunctionLibrary;
 public:
     const UE::GlobalEvents::FDynamicTuple& GetParams() const{ return Params; }
 	
@@ -76,10 +78,23 @@ public:
 	// Add struct value dynamically
 	void Add(const UScriptStruct* InStruct, const void* InSourceAddress);
 
+	// size the parameters up front, pushing the elements of this layout afterwards does not allocate
+	void Reserve(const UE::GlobalEvents::Details::FDynamicTupleLayout& InLayout) { Params.Reserve(InLayout); }
+
+	// remember the layout built since BeginCallSite for that call site, called before the context is broadcast
+	void EndCallSite();
+
 public:
     UFUNCTION(BlueprintCallable)
     int Num() const{ return Params.Num(); }
 
+	/*
+	* Blueprint nodes and script bindings name the call site that is about to fill this context,
+	* the parameters are sized with the layout that call site built the last time.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true"))
+	void BeginCallSite(FName CallSite);
+
 	/*
 	* Add these interface for external script engine
 	* so these engine can add parameter to this context dynamically
@@ -102,13 +117,13 @@ public:
     void AddDouble(double Value){ Params.Push(Value); }
 
     UFUNCTION()
-    void AddString(FString Value){ Params.Push(Value); }
+    void AddString(FString Value){ Params.Push(MoveTemp(Value)); }
 
     UFUNCTION()
     void AddName(FName Value){ Params.Push(Value); }
 
     UFUNCTION()
-    void AddText(FText Value){ Params.Push(Value); }
+    void AddText(FText Value){ Params.Push(MoveTemp(Value)); }
 
     UFUNCTION()
     void AddObject(UObject* Value){ Params.Push(Value); }
@@ -193,6 +208,12 @@ public:
 
 private:
     UE::GlobalEvents::FDynamicTuple Params;
+
+	// set by BeginCallSite until the call site has a cached layout
+	FName PendingCallSite;
+
+	// acquired by UDynamicEventFunctionLibrary::AcquireEventContext, BroadcastEvent returns it to the pool
+	bool bReleasedByBroadcast = false;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGlobalEventDelegateType, const FName&, EventName, UDynamicEventContext*, Context);
@@ -202,21 +223,31 @@ class TDynamicEventContextFactory
 {
 public:
 	// Create new dynamic event context from C++ variadic template parameters
-	static UDynamicEventContext* NewContext(ParamTypes... InParams)
+	static UDynamicEventContext* NewContext(typename UE::GlobalEvents::Details::TEventParam<ParamTypes>::Type... InParams)
 	{
 		UDynamicEventContext* Context = NewObject<UDynamicEventContext>();
 
+		Fill(Context, InParams...);
+
+		return Context;
+	}
+
+	// Add C++ variadic template parameters to an empty context, such as one from FDynamicEventContextPool
+	static void Fill(UDynamicEventContext* InContext, typename UE::GlobalEvents::Details::TEventParam<ParamTypes>::Type... InParams)
+	{
+		checkSlow(InContext != nullptr && InContext->Num() == 0);
+
 		if constexpr (sizeof...(ParamTypes) > 0)
 		{
-			Add(Context, InParams...);
-		}
+			InContext->Reserve(UE::GlobalEvents::Details::TDynamicTupleLayout<ParamTypes...>::Get());
 
-		return Context;
+			Add<ParamTypes...>(InContext, InParams...);
+		}
 	}
 
 private:
 	template <typename T, typename... ExtraParamTypes>
-	static void Add(UDynamicEventContext* InContext, T InValue, ExtraParamTypes... InParams)
+	static void Add(UDynamicEventContext* InContext, typename UE::GlobalEvents::Details::TEventParam<T>::Type InValue, typename UE::GlobalEvents::Details::TEventParam<ExtraParamTypes>::Type... InParams)
 	{
 		InContext->Add<T>(InValue);
 
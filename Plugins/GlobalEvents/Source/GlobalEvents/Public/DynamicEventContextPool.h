@@ -0,0 +1,71 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class UDynamicEventContext;
+
+namespace UE
+{
+    namespace GlobalEvents
+    {
+        /*
+        * Recycles the UDynamicEventContext objects of the game thread broadcast paths,
+        * so broadcasting to Blueprint and script listeners does not create a UObject per event.
+        * A released context is cleared and handed out again, listeners must not keep it past the broadcast.
+        */
+        class GLOBALEVENTS_API FDynamicEventContextPool : public FGCObject
+        {
+        public:
+            FDynamicEventContextPool() = default;
+            virtual ~FDynamicEventContextPool() = default;
+
+            // outer of the contexts created afterwards, they resolve their world through it
+            inline void SetOuter(UObject* InOuter) { Outer = InOuter; }
+
+            // an empty context, created if the pool has none left
+            UDynamicEventContext* Acquire();
+
+            // clear the context and keep it for the next Acquire
+            void Release(UDynamicEventContext* InContext);
+
+            // drop all pooled contexts, they are collected by the next GC
+            void Empty();
+
+            inline int32 Num() const { return FreeContexts.Num(); }
+
+            virtual void AddReferencedObjects(FReferenceCollector& InCollector) override;
+            virtual FString GetReferencerName() const override;
+
+        private:
+            TArray<UDynamicEventContext*>       FreeContexts;
+            TWeakObjectPtr<UObject>             Outer;
+        };
+    }
+}
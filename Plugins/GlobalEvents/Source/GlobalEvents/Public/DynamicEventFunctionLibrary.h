@@ -42,6 +42,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Global Events", meta=(BlueprintInternalUseOnly = "true"))
 	static bool BroadcastEvent(FGameplayTag EventTag, UDynamicEventContext* Context);
 
+    // A context from the pool of the event subsystem, BroadcastEvent returns it to the pool
+	UFUNCTION(BlueprintCallable, Category = "Global Events", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static UDynamicEventContext* AcquireEventContext(UObject* WorldContextObject);
+
     // register a global event
 	UFUNCTION(BlueprintCallable, Category = "Global Events", meta = (DefaultToSelf = "Target", HidePin = "Target"))
 	static bool RegisterGlobalEvent(FGameplayTag EventTag, UObject* Target, FName FunctionName);
@@ -50,6 +54,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Global Events", meta = (DefaultToSelf = "Target", HidePin = "Target"))
 	static bool UnRegisterGlobalEvent(FGameplayTag EventTag, UObject* Target, FName FunctionName);
 
+    // true when a broadcast of this event would reach anyone, the Broadcast Global Event node checks it before building the parameters
+	UFUNCTION(BlueprintPure, Category = "Global Events", meta = (WorldContext = "WorldContextObject"))
+	static bool HasGlobalEventListeners(UObject* WorldContextObject, FGameplayTag EventTag);
+
+    /*
+    * Send a message with the parameters added to the calling node, read straight from the blueprint frame into a tuple on the stack.
+    * Used by the Broadcast Global Event node on engines with variadic functions, CallSite names the node for the layout cache.
+    */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Global Events", meta = (Variadic, WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true"))
+	static bool BroadcastEventWithParams(UObject* WorldContextObject, FGameplayTag EventTag, FName CallSite);
+	DECLARE_FUNCTION(execBroadcastEventWithParams);
+
 	static const FName PushDynamicEventFunctionName;
 private:
     // Internally used interface to dynamically add parameters to UDynamicEventContext
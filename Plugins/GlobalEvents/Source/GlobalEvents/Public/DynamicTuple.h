@@ -29,14 +29,58 @@
 #include "EventParamType.h"
 #include "Details/TypeInfo.h"
 #include "Details/Signature.h"
+#include "Details/DynamicTupleLayout.h"
 
 namespace UE
 {
     namespace GlobalEvents
     {
+        namespace Details
+        {
+            /*
+            * Type-erased lifetime operations for one kind of tuple element.
+            * Tables are static and shared by every element of the same kind, so pushing a value does not allocate.
+            * InContext is the FProperty or UScriptStruct for reflected elements, nullptr for native ones.
+            * Destroy is nullptr when the element needs no destruction.
+            */
+            struct FDynamicTupleElementOps
+            {
+                void (*Copy)(const void* InContext, void* InDest, const void* InSource);
+                void (*Move)(const void* InContext, void* InDest, void* InSource);
+                void (*Destroy)(const void* InContext, void* InAddress);
+            };
+
+            template <typename T>
+            struct TDynamicTupleElementOps
+            {
+                static void Copy(const void*, void* InDest, const void* InSource)
+                {
+                    new (InDest) T(*(const T*)InSource);
+                }
+
+                static void Move(const void*, void* InDest, void* InSource)
+                {
+                    new (InDest) T(MoveTemp(*(T*)InSource));
+                }
+
+                static void Destroy(const void*, void* InAddress)
+                {
+                    ((T*)InAddress)->~T();
+                }
+
+                static constexpr FDynamicTupleElementOps Ops =
+                {
+                    &Copy,
+                    &Move,
+                    TIsTriviallyDestructible<T>::Value ? nullptr : &Destroy
+                };
+            };
+        }
+
         /*
         * Dynamic tuples are designed to dynamically generate data with the same memory layout as TTuple.
         * This data will be used to call the UFunction through the script engine
+        * Small tuples live in an inline buffer, larger ones allocate once when reserved with the layout of their signature.
         */
         class GLOBALEVENTS_API FDynamicTuple
         {
@@ -49,19 +93,27 @@ namespace UE
             FDynamicTuple(FDynamicTuple&& InOther);
             FDynamicTuple& operator = (FDynamicTuple&& InOther);
 
+            // destroy all elements, the buffer is kept for the next parameters
             void Clear();
 
+            // make room for the elements of this layout, pushing them afterwards does not allocate
+            void Reserve(const Details::FDynamicTupleLayout& InLayout);
+
+            // copy the elements of InOther, this tuple must be empty
+            void CopyFrom(const FDynamicTuple& InOther);
+
             inline int32 Num() const { return Signature.Num(); }
 
-            inline const void* GetData() const { return (const void*)TupleBuffer.GetData(); }
+            inline const void* GetData() const { return (const void*)Buffer; }
             inline const ISignature* GetSignature() const { return &Signature; }
-            inline int32 GetOffset(int32 InIndex) const { return TupleElementRecords[InIndex].Offset; }
+            inline const Details::FDynamicTupleLayout& GetLayout() const { return Layout; }
+            inline int32 GetOffset(int32 InIndex) const { return (int32)Layout.GetOffset(InIndex); }
 
         private:
             struct FParamRecord
             {
-                uint32                              Offset;
-                TFunction<void(const void*)>        Deletor;
+                const Details::FDynamicTupleElementOps*     Ops;
+                const void*                                 Context;
             };
 
         public:
@@ -71,21 +123,22 @@ namespace UE
             {
                 static_assert(Details::TTypeInfo<T>::IsSupportedType(), "Unsupported type checked.");
 
-                PushInternal(sizeof(T), alignof(T),
-                    [&](const void* Address) {
-                        *(T*)Address = InValue;
-                    },
-                    [&](const void* InPtr)
-                    {
-                        if constexpr (TIsTriviallyDestructible<T>::Value)
-                        {
-                            if (InPtr != nullptr)
-                            {
-                                ((T*)InPtr)->~T();
-                            }
-                        }
-                    }
-                );
+                const Details::FDynamicTupleElementOps* Ops = &Details::TDynamicTupleElementOps<T>::Ops;
+
+                Ops->Copy(nullptr, PushInternal(Ops, nullptr, sizeof(T), alignof(T)), &InValue);
+
+                Signature.Add<T>();
+            }
+
+            // Add a temporary to the Tuple, moving it into place
+            template <typename T, typename TEnableIf<!TIsReferenceType<T>::Value, int>::Type = 0>
+            inline void Push(T&& InValue)
+            {
+                static_assert(Details::TTypeInfo<T>::IsSupportedType(), "Unsupported type checked.");
+
+                const Details::FDynamicTupleElementOps* Ops = &Details::TDynamicTupleElementOps<T>::Ops;
+
+                Ops->Move(nullptr, PushInternal(Ops, nullptr, sizeof(T), alignof(T)), &InValue);
 
                 Signature.Add<T>();
             }
@@ -99,9 +152,7 @@ namespace UE
                 checkSlow(Details::TTypeInfo<T>::GetTypeId() == Signature.GetParamType(InIndex).GetTypeId());
                 checkSlow(Details::TTypeInfo<T>::GetTypeName() == Signature.GetParamType(InIndex).GetName());
 
-                const FParamRecord& Record = TupleElementRecords[InIndex];
-
-                const uint8* Address = TupleBuffer.GetData() + Record.Offset;
+                const uint8* Address = Buffer + Layout.GetOffset(InIndex);
 
                 return *(const T*)Address;
             }
@@ -115,11 +166,9 @@ namespace UE
                 checkSlow(Details::TTypeInfo<T>::GetTypeId() == Signature.GetParamType(InIndex).GetTypeId());
                 checkSlow(Details::TTypeInfo<T>::GetTypeName() == Signature.GetParamType(InIndex).GetName());
 
-                const FParamRecord& Record = TupleElementRecords[InIndex];
+                uint8* Address = Buffer + Layout.GetOffset(InIndex);
 
-                const uint8* Address = TupleBuffer.GetData() + Record.Offset;
-
-                return *(const T*)Address;
+                return *(T*)Address;
             }
 
             /*
@@ -130,9 +179,7 @@ namespace UE
             {
                 checkSlow(InIndex >= 0 && InIndex < TupleElementRecords.Num());
 
-                const FParamRecord& Record = TupleElementRecords[InIndex];
-
-                const uint8* Address = TupleBuffer.GetData() + Record.Offset;
+                const uint8* Address = Buffer + Layout.GetOffset(InIndex);
 
                 return Address;
             }
@@ -144,17 +191,29 @@ namespace UE
             void Push(const FProperty* InProperty, const void* InSourceAddress);
 
         private:
-            constexpr SIZE_T AlignAddress(SIZE_T InAddress, SIZE_T InAlignment)
-            {
-                return (InAddress + (InAlignment - 1)) & ~(InAlignment - 1);
-            }
+            // Reserve an aligned slot and record it, the caller constructs the element in the returned address
+            void* PushInternal(const Details::FDynamicTupleElementOps* InOps, const void* InContext, int InElementSize, int InAlignmentSize);
+
+            // move the elements to a buffer of at least InCapacity bytes
+            void Grow(uint32 InCapacity, uint32 InAlignment);
 
-            void PushInternal(int InElementSize, int InAlignmentSize, TFunction<void(const void*)>&& InCopyFunctor, TFunction<void(const void*)>&& InDeleteFunctor);
+            inline bool IsInline() const { return Buffer == InlineBuffer; }
+
+            // steal the elements of InOther, this tuple must be empty
+            void MoveFrom(FDynamicTuple& InOther);
+
+        public:
+            static constexpr uint32 InlineCapacity = 64;
+            static constexpr uint32 InlineAlignment = 16;
 
         private:
-            TArray<uint8>                       TupleBuffer;
-            TArray<FParamRecord>                TupleElementRecords;
-            Details::FDynamicSignature          Signature;
+            uint8*                                          Buffer;
+            uint32                                          Capacity;
+            Details::FDynamicTupleLayout                    Layout;
+            TArray<FParamRecord, TInlineAllocator<8>>       TupleElementRecords;
+            Details::FDynamicSignature                      Signature;
+
+            alignas(InlineAlignment) uint8                  InlineBuffer[InlineCapacity];
         };
     }
 }
@@ -98,6 +98,9 @@ public:
 	inline bool IsMap() const { return TypeId == EGlobalEventParameterType::GEPT_Map; }
 
 	inline EGlobalEventParameterType GetTypeId() const { return TypeId; }
+	inline int GetFlags() const { return Flags; }
+	// class, struct or enum of the parameter, null when it is unloaded or the parameter has none
+	inline const UField* GetObjectType() const { return ObjectType.Get(); }
 
 	bool CheckInvokeConvertibleFrom(const FGlobalEventParamType& InSourceParameter) const;
 
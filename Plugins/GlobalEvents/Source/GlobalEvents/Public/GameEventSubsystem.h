@@ -60,6 +60,9 @@ public:
 #include "Inline/EventCenterCommonInterfacesInline.inl"
 #include "Inline/EventCenterTypeSafeInterfacesInline.inl"
 #include "Inline/EventCenterDynamicInterfacesInline.inl"
+#include "Inline/EventCenterQueueInterfacesInline.inl"
+#include "Inline/EventCenterDeferredInterfacesInline.inl"
+#include "Inline/EventCenterCoalescingInterfacesInline.inl"
 #include "Inline/EventCenterSignatureInterfacesInline.inl"
 #endif
 
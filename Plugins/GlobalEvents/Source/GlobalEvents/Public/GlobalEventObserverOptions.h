@@ -0,0 +1,103 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#if ENGINE_MAJOR_VERSION >= 5
+#include "Tasks/Pipe.h"
+#endif
+
+// thread an observer is called on
+enum class EGlobalEventThread : uint8
+{
+    // the broadcasting thread
+    Any,
+    GameThread,
+    RenderThread,
+    // the task pipe of FGlobalEventObserverOptions::Pipe
+    Pipe
+};
+
+/*
+* Optional settings of an observer, passed as the last argument of UGameEventSubsystem::Register.
+*/
+struct FGlobalEventObserverOptions
+{
+    /*
+    * The observer may be called on a task graph worker, at the same time as the other observers of the event.
+    * Such observers are fanned out in parallel once an event has enough of them, see GlobalEvents.ParallelDispatchThreshold.
+    * The order against other observers is undefined, and unless the event center runs in concurrent mode
+    * the observer must not register, unregister or broadcast events.
+    */
+    bool        bConcurrentSafe = false;
+
+    /*
+    * Broadcasts on that thread call the observer inline, others post one delivery per thread which copies the parameters once for all its observers.
+    * Delivered observers don't write back reference parameters, and are skipped when they are unregistered before the delivery runs.
+    * Observers bound to a thread are never called in parallel, bConcurrentSafe is ignored for them.
+    */
+    EGlobalEventThread  Thread = EGlobalEventThread::Any;
+
+#if ENGINE_MAJOR_VERSION >= 5
+    // used when Thread is Pipe, it must outlive the observer
+    UE::Tasks::FPipe*   Pipe = nullptr;
+#endif
+
+    FGlobalEventObserverOptions()
+    {
+    }
+
+    static FGlobalEventObserverOptions ConcurrentSafe()
+    {
+        FGlobalEventObserverOptions Options;
+        Options.bConcurrentSafe = true;
+
+        return Options;
+    }
+
+    static FGlobalEventObserverOptions OnThread(EGlobalEventThread InThread)
+    {
+        check(InThread != EGlobalEventThread::Pipe);
+
+        FGlobalEventObserverOptions Options;
+        Options.Thread = InThread;
+
+        return Options;
+    }
+
+#if ENGINE_MAJOR_VERSION >= 5
+    static FGlobalEventObserverOptions OnPipe(UE::Tasks::FPipe& InPipe)
+    {
+        FGlobalEventObserverOptions Options;
+        Options.Thread = EGlobalEventThread::Pipe;
+        Options.Pipe = &InPipe;
+
+        return Options;
+    }
+#endif
+};
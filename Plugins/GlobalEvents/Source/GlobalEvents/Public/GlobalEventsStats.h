@@ -0,0 +1,54 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("GlobalEvents"), STATGROUP_GlobalEvents, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Compactions"), STAT_GlobalEvents_Compactions, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Compactions Skipped"), STAT_GlobalEvents_CompactionsSkipped, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+// observer entries that a skipped compaction did not have to walk
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Compaction Entries Skipped"), STAT_GlobalEvents_CompactionEntriesSkipped, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+// broadcasts that fanned concurrent-safe observers out over the task graph
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Parallel Dispatches"), STAT_GlobalEvents_ParallelDispatches, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+// broadcasts of coalesced events, and the broadcasts their flushes have dispatched instead
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Coalesced Broadcasts"), STAT_GlobalEvents_CoalescedBroadcasts, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Coalesced Dispatches"), STAT_GlobalEvents_CoalescedDispatches, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+
+// deferred events, see UGameEventSubsystem::Defer
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Deferred Drain"), STAT_GlobalEvents_DeferredDrain, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Deferred Queue Depth"), STAT_GlobalEvents_DeferredQueueDepth, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Deferred Budget Used (ms)"), STAT_GlobalEvents_DeferredBudgetUsed, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+// longest wait of the deferred events dispatched by the last drain
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Deferred Max Latency (ms)"), STAT_GlobalEvents_DeferredMaxLatency, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+// deferred events dispatched over the budget because they reached the max latency of their priority
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Overdue"), STAT_GlobalEvents_DeferredOverdue, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+
+// dynamic event contexts, see FDynamicEventContextPool. every created context is a UObject for the GC to collect
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Contexts Created"), STAT_GlobalEvents_ContextsCreated, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Contexts Reused"), STAT_GlobalEvents_ContextsReused, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Contexts"), STAT_GlobalEvents_PooledContexts, STATGROUP_GlobalEvents, GLOBALEVENTS_API);
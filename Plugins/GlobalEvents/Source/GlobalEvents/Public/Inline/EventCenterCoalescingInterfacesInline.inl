@@ -0,0 +1,99 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+/* This is template include file, don't include it directly. */
+#if !CPP
+#error "don't include this file directly."
+#endif
+
+private:
+	// coalesced events by type-safe event id, created by their first broadcast
+	TArray<TUniquePtr<UE::GlobalEvents::Details::ICoalescedEvent>>	CoalescedEvents;
+	// events with pending values, in the order of their first broadcast since the last flush
+	TArray<UE::GlobalEvents::Details::ICoalescedEvent*>				PendingCoalescedEvents;
+	// broadcasts may come from any thread in concurrent mode
+	FCriticalSection												CoalescingLock;
+
+	template <typename EventType, typename... ParamTypes>
+	inline bool Coalesce(ParamTypes&&... InParams)
+	{
+		static_assert(!EventType::bHasReferenceParameters, "Reference parameters of coalesced events can't be written back.");
+
+		using FCoalescedEventType = typename TChooseClass<
+			EventType::Coalescing == EGlobalEventCoalescing::ByKey,
+			UE::GlobalEvents::Details::TKeyedCoalescedEvent<typename EventType::FPayloadType>,
+			UE::GlobalEvents::Details::TLastValueCoalescedEvent<typename EventType::FPayloadType>
+		>::Result;
+
+		FScopeLock ScopeLock(&CoalescingLock);
+
+		const int32 EventId = EventType::GetEventId();
+
+		if (CoalescedEvents.Num() <= EventId)
+		{
+			CoalescedEvents.SetNum(EventId + 1);
+		}
+
+		TUniquePtr<UE::GlobalEvents::Details::ICoalescedEvent>& Event = CoalescedEvents[EventId];
+
+		if (!Event.IsValid())
+		{
+			Event = MakeUnique<FCoalescedEventType>(&DispatchCoalescedEvent<EventType>);
+		}
+
+		if (!Event->bPending)
+		{
+			Event->bPending = true;
+			PendingCoalescedEvents.Add(Event.Get());
+		}
+
+		static_cast<FCoalescedEventType*>(Event.Get())->Add(Forward<ParamTypes>(InParams)...);
+
+		INC_DWORD_STAT(STAT_GlobalEvents_CoalescedBroadcasts);
+
+		return true;
+	}
+
+	template <typename EventType>
+	static void DispatchCoalescedEvent(void* InContext, void* InPayload)
+	{
+		UGameEventSubsystem* Self = static_cast<UGameEventSubsystem*>(InContext);
+
+		static_cast<typename EventType::FPayloadType*>(InPayload)->ApplyBefore([Self](auto&... InParams)
+			{
+				// the payload was moved aside by Take and is dropped after the broadcast, the observers may take its values
+				Self->template BroadcastNow<EventType>(UE::GlobalEvents::Details::EEventParamOwnership::Owned, InParams...);
+			}
+		);
+	}
+
+	void ResetCoalescedEvents();
+
+public:
+	/*
+	* Broadcast the last values of the coalesced events now, game thread only, returns the number of broadcasts.
+	* It is called once per frame right after FlushQueuedEvents, values coalesced by the observers wait for the next flush.
+	*/
+	int32 FlushCoalescedEvents();
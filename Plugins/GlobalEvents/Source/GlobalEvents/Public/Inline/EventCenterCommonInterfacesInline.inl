@@ -32,7 +32,7 @@ private:
 	template <typename SignatureType, bool bAddNewIfNotExists, bool bIgnoreCheck = false>
 	inline SignatureType* QuerySignalImpl(const FName& InEventName, const UE::GlobalEvents::ISignature* ObserverSignature)
 	{
-		auto* Ptr = EventMaps.Find(InEventName);
+		auto* Ptr = FindSignal(InEventName);
 
 		if (Ptr != nullptr)
 		{
@@ -60,7 +60,7 @@ private:
 
 		if constexpr (bAddNewIfNotExists)
 		{
-			return (SignatureType*)(EventMaps.Emplace(InEventName, MakeShared<SignatureType>()).Get());
+			return (SignatureType*)(AddSignal(InEventName, MakeShared<SignatureType>()).Get());
 		}
 		else
 		{
@@ -69,16 +69,20 @@ private:
 	}
 
 	template <typename SignatureType>
-	inline FDelegateHandle RegisterImpl(const FName& InEventName, UE::GlobalEvents::Details::IEventObserver* InInstance)
+	inline FDelegateHandle RegisterImpl(const FName& InEventName, UE::GlobalEvents::Details::IEventObserver* InInstance, const FGlobalEventObserverOptions& InOptions)
 	{
+		FEventTableWriteScope WriteScope(this);
+
 		auto* Signal = QuerySignalImpl<SignatureType, true>(InEventName, SignatureType::StaticSignature());
 		
-		return Signal != nullptr ? Signal->Connect(InInstance) : FDelegateHandle();
+		return Signal != nullptr ? Signal->Connect(InInstance, InOptions) : FDelegateHandle();
 	}
 
 	template <typename SignatureType>
 	inline bool UnRegisterImpl(const FName& InEventName, UE::GlobalEvents::Details::IEventObserver* InInstance)
 	{
+		FEventTableWriteScope WriteScope(this);
+
 		auto* Signal = QuerySignalImpl<SignatureType, false, true>(InEventName, SignatureType::StaticSignature());
 
 		return Signal != nullptr && Signal->Disconnect(InInstance);
@@ -86,12 +90,13 @@ private:
 
 public:
 	// register for global function or class's static function
+	// observers of every Register overload may be marked concurrent-safe through InOptions, see FGlobalEventObserverOptions
 	template <typename... ParamTypes>
-	inline FDelegateHandle Register(const FName& InEventName, void(*InFunc)(ParamTypes...))
+	inline FDelegateHandle Register(const FName& InEventName, void(*InFunc)(ParamTypes...), const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions())
 	{
 		UE::GlobalEvents::Details::TCommonEventObserver<ParamTypes...> Observer(InFunc);
 
-		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer);
+		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer, InOptions);
 	}
 
 	template <typename... ParamTypes>
@@ -105,14 +110,14 @@ public:
 	// for raw pointer listener
 	// You must UnRegister yourself, otherwise it will cause a crash when the pointer is invalidated.
 	template <typename UserClass, typename... ParamTypes, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
-	inline FDelegateHandle Register(const FName& InEventName, UserClass* InTarget, void (UserClass::* InFunc)(ParamTypes...))
+	inline FDelegateHandle Register(const FName& InEventName, UserClass* InTarget, void (UserClass::* InFunc)(ParamTypes...), const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions())
 	{
 		static_assert(!UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "You can't use UObject method in this method.");
 		checkSlow(InTarget);
 
 		UE::GlobalEvents::Details::TMemberFunctionEventObserver<UserClass, ParamTypes...> Observer(InTarget, InFunc);
 
-		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer);
+		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer, InOptions);
 	}
 
 	template <typename UserClass, typename... ParamTypes, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
@@ -129,14 +134,14 @@ public:
 	// for UObject* pointer
 	// it will save pointer by TWeakObjectPtr
 	template <typename UserClass, typename... ParamTypes, typename TEnableIf<TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
-	inline FDelegateHandle Register(const FName& InEventName, UserClass* InTarget, void (UserClass::* InFunc)(ParamTypes...))
+	inline FDelegateHandle Register(const FName& InEventName, UserClass* InTarget, void (UserClass::* InFunc)(ParamTypes...), const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions())
 	{
 		static_assert(UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "You can only use UObject method in this method.");
 		checkSlow(InTarget);
 
 		UE::GlobalEvents::Details::TBaseUObjectMemberFunctionEventObserver<UserClass, ParamTypes...> Observer(InTarget, InFunc);
 
-		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer);
+		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer, InOptions);
 	}
 
 	template <typename UserClass, typename... ParamTypes, typename TEnableIf<TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
@@ -153,13 +158,13 @@ public:
 	// for TSharedPtr
 	// it will save pointer by TWeakPtr
 	template <typename UserClass, ESPMode Mode, typename... ParamTypes, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
-	inline FDelegateHandle Register(const FName& InEventName, const TSharedPtr<UserClass, Mode>& InTarget, void (UserClass::* InFunc)(ParamTypes...))
+	inline FDelegateHandle Register(const FName& InEventName, const TSharedPtr<UserClass, Mode>& InTarget, void (UserClass::* InFunc)(ParamTypes...), const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions())
 	{
 		static_assert(!UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "You cannot use UObject method in this method.");
 		checkSlow(InTarget);
 
 		UE::GlobalEvents::Details::TSPMemberFunctionEventObserver<UserClass, Mode, ParamTypes...> Observer(InTarget, InFunc);
-		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer);
+		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer, InOptions);
 	}
 
 	template <typename UserClass, ESPMode Mode, typename... ParamTypes, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
@@ -176,11 +181,11 @@ public:
 	// It does not have a corresponding UnRegister function, you must use Handle to : 
 	//		inline bool UnRegister(const FName& InEventName, FDelegateHandle InHandle)
 	template <typename FunctorType, typename... ParamTypes, typename TEnableIf<TIsClass<FunctorType>::Value, int>::Type = 0>
-	inline FDelegateHandle Register(const FName& InEventName, FunctorType&& InFunctor)
+	inline FDelegateHandle Register(const FName& InEventName, FunctorType&& InFunctor, const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions())
 	{
 		typename UE::GlobalEvents::Details::TFunctorEventObserver<FunctorType, ParamTypes...> Observer(MoveTemp(InFunctor));
 
-		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer);
+		return RegisterImpl<UE::GlobalEvents::Details::TSignal<ParamTypes...>>(InEventName, &Observer, InOptions);
 	}
 
 	// for Unreal UFunction
@@ -223,6 +228,8 @@ public:
 
 		UE::GlobalEvents::Details::TUFunctionEventObserver<UserClass> Observer(InTarget, Function);
 
+		FEventTableWriteScope WriteScope(this);
+
 		UE::GlobalEvents::ISignal* Signal = QuerySignalImpl<UE::GlobalEvents::Details::FUFunctionSignal, false, true>(InEventName, &ObserverSignature);
 
 		if (Signal != nullptr)
@@ -242,7 +249,7 @@ public:
 		}
 		else
 		{
-			Signal = EventMaps.Emplace(InEventName, MakeShared<UE::GlobalEvents::Details::FUFunctionSignal>(Function)).Get();
+			Signal = AddSignal(InEventName, MakeShared<UE::GlobalEvents::Details::FUFunctionSignal>(Function)).Get();
 		}
 
 		return Signal != nullptr ? Signal->Connect(&Observer) : FDelegateHandle();
@@ -256,6 +263,8 @@ public:
 
 		UE::GlobalEvents::Details::TUFunctionEventObserver<UserClass> Observer(InTarget, InFunctionName);
 
+		FEventTableWriteScope WriteScope(this);
+
 		auto* Signal = QuerySignalImpl<UE::GlobalEvents::Details::FUFunctionSignal, false, true>(InEventName, nullptr);
 		
 		return Signal != nullptr && Signal->Disconnect(&Observer);
@@ -264,7 +273,9 @@ public:
 	// Unregister by handle
 	inline bool UnRegister(const FName& InEventName, FDelegateHandle InHandle)
 	{
-		auto* Ptr = EventMaps.Find(InEventName);
+		FEventTableWriteScope WriteScope(this);
+
+		auto* Ptr = FindSignal(InEventName);
 
 		return Ptr != nullptr && (*Ptr)->Disconnect(InHandle);
 	}
@@ -274,17 +285,154 @@ public:
 	* Send an event and use template parameters to automatically infer the event signature. 
 	* If the signature does not strictly match, the event will fail to be sent. 
 	* You can find this error through the log.
+	* The signature is the decayed argument types unless it is given explicitly, e.g. Broadcast<int, FString&>(Name, Value, Text).
+	* Arguments are passed to the observers by reference, only observers taking a value copy them.
+	* Arguments passed as rvalues, e.g. MoveTemp(HitResults), are moved into the last observer which can take them.
+	*/
+	template <typename... ParamTypes, typename... ArgTypes>
+	inline bool Broadcast(const FName& InEventName, ArgTypes&&... InParams)
+	{
+		if constexpr (sizeof...(ParamTypes) == 0 && sizeof...(ArgTypes) > 0)
+		{
+			constexpr UE::GlobalEvents::Details::EEventParamOwnership Ownership = UE::GlobalEvents::Details::TEventParamOwnership<typename TDecay<ArgTypes>::Type...>::template From<ArgTypes...>();
+
+			return BroadcastByName<typename TDecay<ArgTypes>::Type...>(InEventName, Ownership, InParams...);
+		}
+		else
+		{
+			constexpr UE::GlobalEvents::Details::EEventParamOwnership Ownership = UE::GlobalEvents::Details::TEventParamOwnership<ParamTypes...>::template From<ArgTypes...>();
+
+			return BroadcastByName<ParamTypes...>(InEventName, Ownership, InParams...);
+		}
+	}
+
+	// Send an event through a slot from ResolveEventSlot, it doesn't need to look up the event name
+	template <typename... ParamTypes, typename... ArgTypes>
+	inline bool Broadcast(const FGlobalEventSlot& InSlot, ArgTypes&&... InParams)
+	{
+		if constexpr (sizeof...(ParamTypes) == 0 && sizeof...(ArgTypes) > 0)
+		{
+			constexpr UE::GlobalEvents::Details::EEventParamOwnership Ownership = UE::GlobalEvents::Details::TEventParamOwnership<typename TDecay<ArgTypes>::Type...>::template From<ArgTypes...>();
+
+			return BroadcastBySlot<typename TDecay<ArgTypes>::Type...>(InSlot, Ownership, InParams...);
+		}
+		else
+		{
+			constexpr UE::GlobalEvents::Details::EEventParamOwnership Ownership = UE::GlobalEvents::Details::TEventParamOwnership<ParamTypes...>::template From<ArgTypes...>();
+
+			return BroadcastBySlot<ParamTypes...>(InSlot, Ownership, InParams...);
+		}
+	}
+
+	// Unregister by handle through a slot from ResolveEventSlot
+	inline bool UnRegister(const FGlobalEventSlot& InSlot, FDelegateHandle InHandle)
+	{
+		FEventTableWriteScope WriteScope(this);
+
+		auto* Ptr = FindSignal(InSlot);
+
+		return Ptr != nullptr && (*Ptr)->Disconnect(InHandle);
+	}
+
+	/*
+	* Check if a broadcast of this event would reach anyone, it doesn't take a lock.
+	* Use it to skip building an expensive payload, an observer connected on another thread meanwhile may be missed.
 	*/
+	inline bool HasListeners(const FName& InEventName) const
+	{
+		if (bConcurrentMode)
+		{
+			UE::GlobalEvents::Details::FReadScope ReadScope;
+
+			return HasListenersOnSignal(FindPublishedSignal(InEventName));
+		}
+
+		const FSignalPtr* Ptr = FindSignal(InEventName);
+
+		return Ptr != nullptr && HasListenersOnSignal(Ptr->Get());
+	}
+
+	inline bool HasListeners(const FGlobalEventSlot& InSlot) const
+	{
+		if (bConcurrentMode)
+		{
+			UE::GlobalEvents::Details::FReadScope ReadScope;
+
+			return HasListenersOnSignal(FindPublishedSignal(InSlot));
+		}
+
+		const FSignalPtr* Ptr = const_cast<UGameEventSubsystem*>(this)->FindSignal(InSlot);
+
+		return Ptr != nullptr && HasListenersOnSignal(Ptr->Get());
+	}
+
+private:
+	inline bool HasListenersOnSignal(const UE::GlobalEvents::ISignal* InSignal) const
+	{
+		if (InSignal == nullptr)
+		{
+			return false;
+		}
+
+#ifdef ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
+		// OnReceiveGlobalEvent hears every event which has a signal
+		if (OnReceiveGlobalEvent.IsBound() && IsInGameThread())
+		{
+			return true;
+		}
+#endif
+
+		return static_cast<const UE::GlobalEvents::Details::FBaseSignal*>(InSignal)->HasObservers();
+	}
+
+	// arguments of another type are converted to the signature once here, everything below passes them on by reference
 	template <typename... ParamTypes>
-	inline bool Broadcast(const FName& InEventName, ParamTypes... InParams)
+	inline bool BroadcastByName(const FName& InEventName, UE::GlobalEvents::Details::EEventParamOwnership InOwnership, typename UE::GlobalEvents::Details::TEventParam<ParamTypes>::Type... InParams)
 	{
-		static_assert(UE::GlobalEvents::Details::TIsSupportedTypes<ParamTypes...>::Value, "Don't use unsupported type");
+		if (bConcurrentMode)
+		{
+			UE::GlobalEvents::Details::FReadScope ReadScope;
 
-		auto* Ptr = EventMaps.Find(InEventName);
+			return BroadcastToSignal<ParamTypes...>(InEventName, FindPublishedSignal(InEventName), InOwnership, InParams...);
+		}
 
-		if (Ptr != nullptr)
+		// observers may clear this event during dispatch, keep the signal alive
+		const FSignalPtr Signal = PinSignal(FindSignal(InEventName));
+
+		return BroadcastToSignal<ParamTypes...>(InEventName, Signal.Get(), InOwnership, InParams...);
+	}
+
+	template <typename... ParamTypes>
+	inline bool BroadcastBySlot(const FGlobalEventSlot& InSlot, UE::GlobalEvents::Details::EEventParamOwnership InOwnership, typename UE::GlobalEvents::Details::TEventParam<ParamTypes>::Type... InParams)
+	{
+		if (bConcurrentMode)
+		{
+			UE::GlobalEvents::Details::FReadScope ReadScope;
+
+			return BroadcastToSignal<ParamTypes...>(InSlot.EventName, FindPublishedSignal(InSlot), InOwnership, InParams...);
+		}
+
+		const FSignalPtr Signal = PinSignal(FindSignal(InSlot));
+
+		return BroadcastToSignal<ParamTypes...>(InSlot.EventName, Signal.Get(), InOwnership, InParams...);
+	}
+
+	template <typename... ParamTypes>
+	inline bool BroadcastToSignal(const FName& InEventName, UE::GlobalEvents::ISignal* InSignal, UE::GlobalEvents::Details::EEventParamOwnership InOwnership, typename UE::GlobalEvents::Details::TEventParam<ParamTypes>::Type... InParams)
+	{
+		static_assert(UE::GlobalEvents::Details::TIsSupportedTypes<ParamTypes...>::Value, "Don't use unsupported type");
+
+		if (InSignal != nullptr)
 		{
-			if (!UE::GlobalEvents::Details::TSignalInvoker<ParamTypes...>::Invoke(*Ptr, InEventName, InParams...))
+#ifdef ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
+			// OnReceiveGlobalEvent reads the values after the observers
+			if (OnReceiveGlobalEvent.IsBound() && IsInGameThread())
+			{
+				InOwnership = UE::GlobalEvents::Details::EEventParamOwnership::Borrowed;
+			}
+#endif
+
+			if (!UE::GlobalEvents::Details::TSignalInvoker<ParamTypes...>::Invoke(InSignal, InEventName, InOwnership, InParams...))
 			{
 				return false;
 			}
@@ -298,11 +446,15 @@ public:
             * Then you need to define this macro: 
                   ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
             */
-			if (OnReceiveGlobalEvent.IsBound())
+			// blueprint delegates are game thread only
+			if (OnReceiveGlobalEvent.IsBound() && IsInGameThread())
 			{
-				UDynamicEventContext* Context = TDynamicEventContextFactory<ParamTypes...>::NewContext(InParams...);
+				UDynamicEventContext* Context = AcquireDynamicEventContext();
+				TDynamicEventContextFactory<ParamTypes...>::Fill(Context, InParams...);
 
 				OnReceiveGlobalEvent.Broadcast(InEventName, Context);
+
+				ReleaseDynamicEventContext(Context);
 			}
 #endif
 
@@ -312,24 +464,31 @@ public:
 		return false;
 	}
 
+public:
 	// shutdown this service
 	inline void Shutdown()
 	{
+		FEventTableWriteScope WriteScope(this);
+
 		// release all delegates
-		for (auto Pair : EventMaps)
+		// Broadcast will keep Signal instance reference
+		// so reset the signals is safe, slots are kept for the resolved FGlobalEventSlot
+		for (FEventSlotEntry& Slot : EventSlots)
 		{
-			Pair.Value->DisconnectAll();
+			if (Slot.Signal.IsValid())
+			{
+				Slot.Signal->DisconnectAll();
+				ResetSlotSignal(Slot);
+			}
 		}
-
-		// Broadcast will keep Signal instance reference
-		// so clear this map is safe
-		EventMaps.Empty();
 	}
 
 	// Clear all observers for an event
 	inline void ClearEventObservers(const FName& InEventName)
 	{
-		auto* Ptr = EventMaps.Find(InEventName);
+		FEventTableWriteScope WriteScope(this);
+
+		auto* Ptr = FindSignal(InEventName);
 
 		if (Ptr == nullptr)
 		{
@@ -341,5 +500,5 @@ public:
 		(*Ptr)->DisconnectAll();
 
 		// remove container
-		EventMaps.Remove(InEventName);
+		RemoveSignal(InEventName);
 	}
@@ -30,5 +30,290 @@
 
 private:
 	typedef TSharedPtr<UE::GlobalEvents::ISignal>	FSignalPtr;
-	TMap<FName, FSignalPtr>		EventMaps;
+
+	struct FEventSlotEntry
+	{
+		FName			EventName;
+		FSignalPtr		Signal;
+	};
+
+	// signals live in a dense array so that FGlobalEventSlot can address them by index
+	// slots are never removed, a cleared event keeps its slot with an empty signal
+	TArray<FEventSlotEntry>		EventSlots;
+	TMap<FName, int32>			EventSlotIndices;
+
+	// type-safe event id -> slot index, see DEFINE_TYPESAFE_GLOBAL_EVENT
+	TArray<int32>				TypeSafeSlotIndices;
+
+	// identifies this event center in the slots it resolved
+	uint32						EventSlotsSerial = GenerateEventSlotsSerial();
+
+	static uint32 GenerateEventSlotsSerial();
+
+	// immutable copy of the slots for concurrent mode, Broadcast reads it without locks
+	struct FPublishedEventTable
+	{
+		TMap<FName, int32>							SlotIndices;
+		TArray<UE::GlobalEvents::ISignal*>			Signals;
+		TArray<int32>								TypeSafeSlotIndices;
+	};
+
+	std::atomic<FPublishedEventTable*>	PublishedEventTable{ nullptr };
+	// serializes all writers in concurrent mode
+	FCriticalSection					EventTableLock;
+	// signals removed since the last publish, they are retired together with the old table
+	TArray<FSignalPtr>					RemovedSignals;
+	bool								bEventTableChanged = false;
+	bool								bConcurrentMode = false;
+
+	// publish a new FPublishedEventTable, EventTableLock must be held
+	void PublishEventTable();
+
+	// locks the writers in concurrent mode and publishes the changed slots when it ends
+	struct FEventTableWriteScope
+	{
+		UGameEventSubsystem* Owner;
+
+		inline FEventTableWriteScope(UGameEventSubsystem* InOwner) :
+			Owner(InOwner)
+		{
+			if (Owner->bConcurrentMode)
+			{
+				Owner->EventTableLock.Lock();
+			}
+		}
+
+		inline ~FEventTableWriteScope()
+		{
+			if (Owner->bConcurrentMode)
+			{
+				if (Owner->bEventTableChanged)
+				{
+					Owner->PublishEventTable();
+				}
+
+				Owner->EventTableLock.Unlock();
+			}
+		}
+	};
+
+	inline int32 FindOrAddEventSlot(const FName& InEventName)
+	{
+		if (const int32* IndexPtr = EventSlotIndices.Find(InEventName))
+		{
+			return *IndexPtr;
+		}
+
+		const int32 Index = EventSlots.Add(FEventSlotEntry{ InEventName, FSignalPtr() });
+		EventSlotIndices.Add(InEventName, Index);
+		bEventTableChanged = true;
+
+		return Index;
+	}
+
+	static inline FSignalPtr PinSignal(const FSignalPtr* InPtr)
+	{
+		return InPtr != nullptr ? *InPtr : FSignalPtr();
+	}
+
+	inline FSignalPtr* FindSignal(const FName& InEventName)
+	{
+		const int32* IndexPtr = EventSlotIndices.Find(InEventName);
+
+		if (IndexPtr == nullptr)
+		{
+			return nullptr;
+		}
+
+		FSignalPtr& Signal = EventSlots[*IndexPtr].Signal;
+
+		return Signal.IsValid() ? &Signal : nullptr;
+	}
+
+	inline const FSignalPtr* FindSignal(const FName& InEventName) const
+	{
+		return const_cast<UGameEventSubsystem*>(this)->FindSignal(InEventName);
+	}
+
+	inline FSignalPtr* FindSignal(const FGlobalEventSlot& InSlot)
+	{
+		if (InSlot.OwnerSerial != EventSlotsSerial || !EventSlots.IsValidIndex(InSlot.Index))
+		{
+			return FindSignal(InSlot.EventName);
+		}
+
+		checkSlow(EventSlots[InSlot.Index].EventName == InSlot.EventName);
+
+		FSignalPtr& Signal = EventSlots[InSlot.Index].Signal;
+
+		return Signal.IsValid() ? &Signal : nullptr;
+	}
+
+	template <typename EventType>
+	inline FEventSlotEntry& GetTypeSafeEventSlot()
+	{
+		const int32 EventId = EventType::GetEventId();
+
+		if (EventId >= TypeSafeSlotIndices.Num())
+		{
+			const int32 NumToAdd = EventId + 1 - TypeSafeSlotIndices.Num();
+
+			TypeSafeSlotIndices.Reserve(EventId + 1);
+
+			for (int32 i = 0; i < NumToAdd; ++i)
+			{
+				TypeSafeSlotIndices.Add(INDEX_NONE);
+			}
+		}
+
+		int32& SlotIndex = TypeSafeSlotIndices[EventId];
+
+		if (SlotIndex == INDEX_NONE)
+		{
+			SlotIndex = FindOrAddEventSlot(EventType::GetEventName());
+			bEventTableChanged = true;
+		}
+
+		return EventSlots[SlotIndex];
+	}
+
+	// unlike GetTypeSafeEventSlot it never adds a slot, so broadcasting an event nobody listens to leaves the table alone
+	template <typename EventType>
+	inline FSignalPtr* FindTypeSafeSignal()
+	{
+		const int32 EventId = EventType::GetEventId();
+
+		if (TypeSafeSlotIndices.IsValidIndex(EventId) && TypeSafeSlotIndices[EventId] != INDEX_NONE)
+		{
+			FSignalPtr& Signal = EventSlots[TypeSafeSlotIndices[EventId]].Signal;
+
+			return Signal.IsValid() ? &Signal : nullptr;
+		}
+
+		return FindSignal(EventType::GetEventName());
+	}
+
+	inline FSignalPtr& SetSlotSignal(FEventSlotEntry& InSlot, FSignalPtr&& InSignal)
+	{
+		checkSlow(!InSlot.Signal.IsValid());
+
+		if (bConcurrentMode)
+		{
+			static_cast<UE::GlobalEvents::Details::FBaseSignal*>(InSignal.Get())->EnableConcurrentDispatch();
+		}
+
+		InSlot.Signal = MoveTemp(InSignal);
+		bEventTableChanged = true;
+
+		return InSlot.Signal;
+	}
+
+	inline void ResetSlotSignal(FEventSlotEntry& InSlot)
+	{
+		if (!InSlot.Signal.IsValid())
+		{
+			return;
+		}
+
+		// concurrent readers may still dispatch on it, it is released after they have left
+		if (bConcurrentMode)
+		{
+			RemovedSignals.Add(MoveTemp(InSlot.Signal));
+		}
+
+		InSlot.Signal.Reset();
+		bEventTableChanged = true;
+	}
+
+	inline FSignalPtr& AddSignal(const FName& InEventName, FSignalPtr&& InSignal)
+	{
+		return SetSlotSignal(EventSlots[FindOrAddEventSlot(InEventName)], MoveTemp(InSignal));
+	}
+
+	inline void RemoveSignal(const FName& InEventName)
+	{
+		if (const int32* IndexPtr = EventSlotIndices.Find(InEventName))
+		{
+			ResetSlotSignal(EventSlots[*IndexPtr]);
+		}
+	}
+
+	// concurrent mode only, must be called inside a read scope and the signal is valid until it ends
+	inline UE::GlobalEvents::ISignal* FindPublishedSignal(const FName& InEventName) const
+	{
+		const FPublishedEventTable* Table = PublishedEventTable.load(std::memory_order_acquire);
+
+		if (Table == nullptr)
+		{
+			return nullptr;
+		}
+
+		const int32* IndexPtr = Table->SlotIndices.Find(InEventName);
+
+		return IndexPtr != nullptr ? Table->Signals[*IndexPtr] : nullptr;
+	}
+
+	inline UE::GlobalEvents::ISignal* FindPublishedSignal(const FGlobalEventSlot& InSlot) const
+	{
+		const FPublishedEventTable* Table = PublishedEventTable.load(std::memory_order_acquire);
+
+		if (Table == nullptr)
+		{
+			return nullptr;
+		}
+
+		if (InSlot.OwnerSerial != EventSlotsSerial || !Table->Signals.IsValidIndex(InSlot.Index))
+		{
+			return FindPublishedSignal(InSlot.EventName);
+		}
+
+		return Table->Signals[InSlot.Index];
+	}
+
+	template <typename EventType>
+	inline UE::GlobalEvents::ISignal* FindPublishedTypeSafeSignal() const
+	{
+		const FPublishedEventTable* Table = PublishedEventTable.load(std::memory_order_acquire);
+
+		if (Table == nullptr)
+		{
+			return nullptr;
+		}
+
+		const int32 EventId = EventType::GetEventId();
+
+		if (Table->TypeSafeSlotIndices.IsValidIndex(EventId) && Table->TypeSafeSlotIndices[EventId] != INDEX_NONE)
+		{
+			return Table->Signals[Table->TypeSafeSlotIndices[EventId]];
+		}
+
+		return FindPublishedSignal(EventType::GetEventName());
+	}
+
+public:
+	/*
+	* Resolve the event name once and broadcast through the returned slot,
+	* the slot can be resolved before the event has a signal.
+	*/
+	inline FGlobalEventSlot ResolveEventSlot(const FName& InEventName)
+	{
+		FEventTableWriteScope WriteScope(this);
+
+		return FGlobalEventSlot(InEventName, FindOrAddEventSlot(InEventName), EventSlotsSerial);
+	}
+
+	/*
+	* Allow Broadcast from any thread.
+	* Broadcast reads an immutable copy of the events and their observers without taking a lock,
+	* except when its signature isn't the last one verified for the event, then it is checked under the read lock of the signature registry.
+	* Register, UnRegister and the other writers are serialized by a lock and publish a new copy.
+	* Observers are called on the broadcasting thread, and may still be called shortly after they are unregistered on another thread.
+	* It must be enabled before any event is registered, see also GlobalEvents.ConcurrentMode.
+	*/
+	bool EnableConcurrentMode();
+
+	inline bool IsConcurrentMode() const
+	{
+		return bConcurrentMode;
+	}
 
@@ -0,0 +1,69 @@
+﻿/*
+    MIT License
+
+    Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+    Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+/* This is template include file, don't include it directly. */
+#if !CPP
+#error "don't include this file directly."
+#endif
+
+private:
+	// events posted by Defer, drained under a time budget by QueueTickFunction
+	UE::GlobalEvents::Details::FDeferredEventQueue	DeferredEvents;
+
+public:
+	/*
+	* Defer a type-safe event, game thread only. Use Enqueue on other threads.
+	* Deferred events are broadcast once per frame after the queued events, by priority, until GlobalEvents.DeferredBudgetMs is used up.
+	* An event that has waited for GlobalEvents.DeferredMaxLatencyMs of its priority is broadcast at the next drain regardless of the budget.
+	* Parameters are copied, so reference parameters are not written back.
+	*/
+	template <typename EventType, typename... ParamTypes>
+	inline void Defer(EGlobalEventPriority InPriority, ParamTypes&&... InParams)
+	{
+		check(IsInGameThread());
+
+		DeferredEvents.template Emplace<typename EventType::FPayloadType>(InPriority, &DispatchQueuedEvent<EventType>, Forward<ParamTypes>(InParams)...);
+	}
+
+	// Defer an event by name, the signature is checked when it is broadcast
+	template <typename... ParamTypes>
+	inline void Defer(const FName& InEventName, EGlobalEventPriority InPriority, ParamTypes&&... InParams)
+	{
+		static_assert(UE::GlobalEvents::Details::TIsSupportedTypes<typename TDecay<ParamTypes>::Type...>::Value, "Don't use unsupported type");
+
+		check(IsInGameThread());
+
+		using FPayloadType = TTuple<FName, typename TDecay<ParamTypes>::Type...>;
+
+		DeferredEvents.template Emplace<FPayloadType>(InPriority, &DispatchQueuedNamedEvent<FPayloadType>, InEventName, Forward<ParamTypes>(InParams)...);
+	}
+
+	// Broadcast deferred events until InBudgetSeconds are used, overdue events are always broadcast, returns the number of events
+	int32 DrainDeferredEvents(double InBudgetSeconds);
+
+	inline int32 GetNumDeferredEvents() const
+	{
+		return DeferredEvents.Num();
+	}
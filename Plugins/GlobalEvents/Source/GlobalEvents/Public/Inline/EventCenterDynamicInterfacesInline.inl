@@ -32,37 +32,121 @@ public:
     // Send an event, the parameters of this event are provided using DynamicTuple 
     inline bool BroadcastDynamic(const FName& InEventName, UDynamicEventContext* InContext)
     {
-        checkSlow(InContext != nullptr);
+        if (bConcurrentMode)
+        {
+            UE::GlobalEvents::Details::FReadScope ReadScope;
 
-        if (InContext == nullptr)
+            return BroadcastDynamicToSignal(InEventName, FindPublishedSignal(InEventName), InContext);
+        }
+
+        // keep the signal alive, observers may clear this event during dispatch
+        const FSignalPtr Signal = PinSignal(FindSignal(InEventName));
+
+        return BroadcastDynamicToSignal(InEventName, Signal.Get(), InContext);
+    }
+
+    // Send an event through a slot from ResolveEventSlot, the parameters of this event are provided using DynamicTuple 
+    inline bool BroadcastDynamic(const FGlobalEventSlot& InSlot, UDynamicEventContext* InContext)
+    {
+        if (bConcurrentMode)
         {
+            UE::GlobalEvents::Details::FReadScope ReadScope;
+
+            return BroadcastDynamicToSignal(InSlot.EventName, FindPublishedSignal(InSlot), InContext);
+        }
+
+        const FSignalPtr Signal = PinSignal(FindSignal(InSlot));
+
+        return BroadcastDynamicToSignal(InSlot.EventName, Signal.Get(), InContext);
+    }
+
+    /*
+    * Send an event whose parameters were pushed to a tuple without a context, such as the Blueprint broadcast node does.
+    * The tuple is only moved to a pooled context if OnReceiveGlobalEvent is bound.
+    */
+    inline bool BroadcastDynamic(const FName& InEventName, UE::GlobalEvents::FDynamicTuple&& InParams)
+    {
+        if (bConcurrentMode)
+        {
+            UE::GlobalEvents::Details::FReadScope ReadScope;
+
+            return BroadcastDynamicToSignal(InEventName, FindPublishedSignal(InEventName), MoveTemp(InParams));
+        }
+
+        const FSignalPtr Signal = PinSignal(FindSignal(InEventName));
+
+        return BroadcastDynamicToSignal(InEventName, Signal.Get(), MoveTemp(InParams));
+    }
+
+private:
+    inline bool RaiseDynamicEvent(const FName& InEventName, UE::GlobalEvents::ISignal* InSignal, const UE::GlobalEvents::FDynamicTuple& InParams)
+    {
+        auto SourceSignature = InParams.GetSignature();
+
+        if (!InSignal->GetSignature()->CheckInvokeableFrom(SourceSignature))
+        {
+            UE_LOG(GlobalEventsLog, Error,
+                TEXT("Invalid Operation, failed convert signature. EventName = (%s), Signal Signature = (%s), Broadcast Signature = (%s)"),
+                *InEventName.ToString(),
+                *InSignal->GetSignature()->ToString(),
+                *SourceSignature->ToString()
+            );
+
             return false;
         }
 
-        auto* Ptr = EventMaps.Find(InEventName);
+        // dynamic signals copy the tuple for their observers bound to another thread
+        if (InSignal->GetInvokeType() == (int)UE::GlobalEvents::Details::ESignalInvokeType::Dynamic)
+        {
+            static_cast<UE::GlobalEvents::Details::FBaseDynamicSignal*>(InSignal)->RaiseDynamicEvent(InParams);
+        }
+        else
+        {
+            InSignal->ExecuteRaiseEvent(InParams.GetData());
+        }
+
+        return true;
+    }
 
-        if (Ptr != nullptr)
+    inline bool BroadcastDynamicToSignal(const FName& InEventName, UE::GlobalEvents::ISignal* InSignal, UE::GlobalEvents::FDynamicTuple&& InParams)
+    {
+        if (InSignal == nullptr || !RaiseDynamicEvent(InEventName, InSignal, InParams))
         {
-            auto Signal = Ptr->Get();
+            return false;
+        }
 
-            checkSlow(Signal != nullptr);
+#ifdef ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
+        // blueprint delegates are game thread only
+        if (OnReceiveGlobalEvent.IsBound() && IsInGameThread())
+        {
+            UDynamicEventContext* Context = AcquireDynamicEventContext();
+            Context->Reset(MoveTemp(InParams));
 
-            auto SourceSignature = InContext->GetParams().GetSignature();
+            OnReceiveGlobalEvent.Broadcast(InEventName, Context);
 
-            if (!Signal->GetSignature()->CheckInvokeableFrom(SourceSignature))
-            {
-                UE_LOG(GlobalEventsLog, Error,
-                    TEXT("Invalid Operation, failed convert signature. EventName = (%s), Signal Signature = (%s), Broadcast Signature = (%s)"),
-                    *InEventName.ToString(),
-                    *Signal->GetSignature()->ToString(),
-                    *SourceSignature->ToString()
-                );
+            ReleaseDynamicEventContext(Context);
+        }
+#endif
+
+        return true;
+    }
 
+    inline bool BroadcastDynamicToSignal(const FName& InEventName, UE::GlobalEvents::ISignal* InSignal, UDynamicEventContext* InContext)
+    {
+        checkSlow(InContext != nullptr);
+
+        if (InContext == nullptr)
+        {
+            return false;
+        }
+
+        if (InSignal != nullptr)
+        {
+            if (!RaiseDynamicEvent(InEventName, InSignal, InContext->GetParams()))
+            {
                 return false;
             }
 
-            Signal->ExecuteRaiseEvent(InContext->GetParams().GetData());
-
 #ifdef ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
             /*
             * To enable this capability, you need to add the following delegate definition to the host class:
@@ -72,7 +156,8 @@ public:
             * Then you need to define this macro: 
                   ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
             */
-            if (OnReceiveGlobalEvent.IsBound())
+            // blueprint delegates are game thread only
+            if (OnReceiveGlobalEvent.IsBound() && IsInGameThread())
             {
                 OnReceiveGlobalEvent.Broadcast(InEventName, InContext);
             }
@@ -83,3 +168,21 @@ public:
         return false;
     }
 
+public:
+    /*
+    * Dynamic event contexts for game thread broadcasts, see FDynamicEventContextPool.
+    * A context must be released once its broadcast returned, listeners must not keep it.
+    */
+    inline UDynamicEventContext* AcquireDynamicEventContext()
+    {
+        return DynamicEventContextPool.Acquire();
+    }
+
+    inline void ReleaseDynamicEventContext(UDynamicEventContext* InContext)
+    {
+        DynamicEventContextPool.Release(InContext);
+    }
+
+private:
+    UE::GlobalEvents::FDynamicEventContextPool      DynamicEventContextPool;
+
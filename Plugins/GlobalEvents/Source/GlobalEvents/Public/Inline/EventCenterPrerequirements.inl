@@ -31,5 +31,15 @@
 #include "Details/EventDefine.h"
 #include "DynamicTuple.h"
 #include "DynamicEventContext.h"
+#include "DynamicEventContextPool.h"
+#include "GlobalEventSlot.h"
+#include "Details/ReadCopyUpdate.h"
+#include "Details/EventQueue.h"
+#include "Details/CoalescedEvents.h"
+#include "Details/DeferredEventQueue.h"
+#include "GlobalEventsStats.h"
+#include "Engine/EngineBaseTypes.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
 
 
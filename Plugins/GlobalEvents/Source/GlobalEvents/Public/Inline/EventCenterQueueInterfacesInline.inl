@@ -0,0 +1,106 @@
+﻿/*
+	MIT License
+
+	Copyright (c) 2023 GlobalEvents Plugin For UnrealEngine
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Project URL: https://github.com/bodong1987/UnrealEngine.GlobalEvents
+*/
+/* This is template include file, don't include it directly. */
+#if !CPP
+#error "don't include this file directly."
+#endif
+
+private:
+	// events posted by Enqueue, drained on the game thread by QueueTickFunction
+	TUniquePtr<UE::GlobalEvents::Details::FEventQueue>	EventQueue;
+
+	struct FEventQueueTickFunction : public FTickFunction
+	{
+		UGameEventSubsystem*	Owner = nullptr;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override;
+	};
+
+	FEventQueueTickFunction		QueueTickFunction;
+	TWeakObjectPtr<UWorld>		QueueTickWorld;
+	FDelegateHandle				PostWorldInitializationHandle;
+	FDelegateHandle				WorldCleanupHandle;
+
+	void InitializeEventQueue();
+	void DeinitializeEventQueue();
+	void RegisterQueueTickFunction(UWorld* InWorld);
+	void UnRegisterQueueTickFunction();
+
+	// the payload is destroyed after the dispatch, so its values are moved to the observers
+	template <typename EventType>
+	static void DispatchQueuedEvent(void* InContext, void* InPayload)
+	{
+		UGameEventSubsystem* Self = static_cast<UGameEventSubsystem*>(InContext);
+
+		static_cast<typename EventType::FPayloadType*>(InPayload)->ApplyBefore([Self](auto&... InParams)
+			{
+				Self->template Broadcast<EventType>(MoveTemp(InParams)...);
+			}
+		);
+	}
+
+	template <typename PayloadType>
+	static void DispatchQueuedNamedEvent(void* InContext, void* InPayload)
+	{
+		UGameEventSubsystem* Self = static_cast<UGameEventSubsystem*>(InContext);
+
+		static_cast<PayloadType*>(InPayload)->ApplyBefore([Self](const FName& InEventName, auto&... InParams)
+			{
+				Self->Broadcast(InEventName, MoveTemp(InParams)...);
+			}
+		);
+	}
+
+public:
+	/*
+	* Post a type-safe event from any thread, it is broadcast on the game thread by the next flush.
+	* The queue is flushed once per frame in the tick group of GlobalEvents.QueueTickGroup.
+	* Parameters are copied into the queue, so reference parameters are not written back.
+	*/
+	template <typename EventType, typename... ParamTypes>
+	inline void Enqueue(ParamTypes&&... InParams)
+	{
+		checkf(EventQueue.IsValid(), TEXT("Enqueue is only available between Initialize and Deinitialize."));
+
+		EventQueue->template Emplace<typename EventType::FPayloadType>(&DispatchQueuedEvent<EventType>, Forward<ParamTypes>(InParams)...);
+	}
+
+	// Post an event by name from any thread, the signature is checked when it is broadcast
+	template <typename... ParamTypes>
+	inline void Enqueue(const FName& InEventName, ParamTypes&&... InParams)
+	{
+		static_assert(UE::GlobalEvents::Details::TIsSupportedTypes<typename TDecay<ParamTypes>::Type...>::Value, "Don't use unsupported type");
+
+		checkf(EventQueue.IsValid(), TEXT("Enqueue is only available between Initialize and Deinitialize."));
+
+		using FPayloadType = TTuple<FName, typename TDecay<ParamTypes>::Type...>;
+
+		EventQueue->template Emplace<FPayloadType>(&DispatchQueuedNamedEvent<FPayloadType>, InEventName, Forward<ParamTypes>(InParams)...);
+	}
+
+	// Broadcast the queued events now, game thread only, returns the number of events
+	int32 FlushQueuedEvents();
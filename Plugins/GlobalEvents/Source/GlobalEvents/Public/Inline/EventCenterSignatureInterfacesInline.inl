@@ -32,14 +32,16 @@ private:
 	template <typename FunctorType>
 	inline bool BindSignatureInternal(const FName& InEventName, FunctorType&& InFunctor)
 	{
-		auto* Ptr = EventMaps.Find(InEventName);
+		FEventTableWriteScope WriteScope(this);
+
+		auto* Ptr = FindSignal(InEventName);
 
 		if (Ptr != nullptr)
 		{
 			return false;
 		}
 
-		EventMaps.Emplace(InEventName, InFunctor());
+		AddSignal(InEventName, InFunctor());
 
 		return true;
 
@@ -81,11 +83,13 @@ public:
 	// Unbind a signature
 	inline bool UnBindSignature(const FName& InEventName)
 	{
-		auto* Ptr = EventMaps.Find(InEventName);
+		FEventTableWriteScope WriteScope(this);
+
+		auto* Ptr = FindSignal(InEventName);
 
 		if (Ptr != nullptr && Ptr->Get()->IsEmpty())
 		{
-			EventMaps.Remove(InEventName);
+			RemoveSignal(InEventName);
 
 			return true;
 		}
@@ -102,7 +106,16 @@ public:
 	*/
 	inline const UE::GlobalEvents::ISignature* FindSignature(const FName& InEventName) const
 	{
-		auto* Ptr = EventMaps.Find(InEventName);
+		if (bConcurrentMode)
+		{
+			UE::GlobalEvents::Details::FReadScope ReadScope;
+
+			const UE::GlobalEvents::ISignal* Signal = FindPublishedSignal(InEventName);
+
+			return Signal != nullptr ? Signal->GetSignature() : nullptr;
+		}
+
+		auto* Ptr = FindSignal(InEventName);
 
 		return Ptr != nullptr && Ptr->Get() != nullptr ? Ptr->Get()->GetSignature() : nullptr;
 	}
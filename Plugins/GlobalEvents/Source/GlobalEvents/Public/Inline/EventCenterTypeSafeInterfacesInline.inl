@@ -32,13 +32,16 @@ private:
 	template <typename EventType, bool bAddNewIfNotExists = true, bool bIgnoreCheck = false>
 	inline typename EventType::FSignalType* QueryTypedSignalImpl()
 	{
-		auto* Ptr = EventMaps.Find(EventType::GetEventName());
+		FEventSlotEntry& Slot = GetTypeSafeEventSlot<EventType>();
+		auto* Ptr = Slot.Signal.IsValid() ? &Slot.Signal : nullptr;
 
 		if (Ptr != nullptr)
 		{
 			if constexpr (!bIgnoreCheck)
 			{
-				if (!EventType::StaticSignature()->CheckInvokeableFrom((*Ptr)->GetSignature()))
+				// a TSignal of the event's own parameters shares its static signature, no check is needed
+				if ((*Ptr)->GetSignature() != EventType::StaticSignature() && 
+					!EventType::StaticSignature()->CheckInvokeableFrom((*Ptr)->GetSignature()))
 				{
 					UE_LOG(GlobalEventsLog, Error,						
 						TEXT("Invalid Operation, failed convert signature. EventName = (%s), Signal Signature = (%s), Observer Signature = (%s)"),
@@ -56,7 +59,7 @@ private:
 
 		if constexpr (bAddNewIfNotExists)
 		{
-			return (typename EventType::FSignalType*)(EventMaps.Emplace(EventType::GetEventName(), MakeShared<typename EventType::FSignalType>()).Get());
+			return (typename EventType::FSignalType*)SetSlotSignal(Slot, MakeShared<typename EventType::FSignalType>()).Get();
 		}
 		else
 		{
@@ -65,17 +68,21 @@ private:
 	}
 
 	template <typename EventType>
-	inline FDelegateHandle RegisterImpl(UE::GlobalEvents::Details::IEventObserver* InInstance)
+	inline FDelegateHandle RegisterImpl(UE::GlobalEvents::Details::IEventObserver* InInstance, const FGlobalEventObserverOptions& InOptions)
 	{
+		FEventTableWriteScope WriteScope(this);
+
 		auto* Signal = QueryTypedSignalImpl<EventType, true>();
 		check(Signal);
 
-		return Signal->Connect(InInstance);
+		return Signal->Connect(InInstance, InOptions);
 	}
 
 	template <typename EventType>
 	inline bool UnRegisterImpl(UE::GlobalEvents::Details::IEventObserver* InInstance)
 	{
+		FEventTableWriteScope WriteScope(this);
+
 		auto* Signal = QueryTypedSignalImpl<EventType, false>();
 
 		return Signal != nullptr && Signal->Disconnect(InInstance);
@@ -86,11 +93,11 @@ public:
 	* Register A common Function
 	*/
 	template <typename EventType>
-	inline FDelegateHandle Register(typename EventType::FCommonEventObserverType::FunctionType InFunc)
+	inline FDelegateHandle Register(typename EventType::FCommonEventObserverType::FunctionType InFunc, const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions())
 	{
 		typename EventType::FCommonEventObserverType Observer(InFunc);
 
-		return RegisterImpl<EventType>(&Observer);
+		return RegisterImpl<EventType>(&Observer, InOptions);
 	}
 
 	template <typename EventType>
@@ -103,18 +110,20 @@ public:
 
 	/*
 	* Register A member function for common class/object
+	* UserClass must be a class, otherwise Register(InFunc, InOptions) of a common function would deduce it from the function pointer
 	*/
-	template <typename EventType, typename UserClass, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
+	template <typename EventType, typename UserClass, typename TEnableIf<TIsClass<UserClass>::Value && !TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
 	inline FDelegateHandle Register(
 		UserClass* InTarget,
-		typename EventType::template TMemberFunctionEventObserverType<UserClass>::MemberFunctionType InFunc
+		typename EventType::template TMemberFunctionEventObserverType<UserClass>::MemberFunctionType InFunc,
+		const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions()
 	)
 	{
 		static_assert(!UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "You cannot use UObject method in this method.");
 		checkSlow(InTarget);
 
 		typename EventType::template TMemberFunctionEventObserverType<UserClass> Observer(InTarget, InFunc);
-		return RegisterImpl<EventType>(&Observer);
+		return RegisterImpl<EventType>(&Observer, InOptions);
 	}
 
 	template <typename EventType, typename UserClass, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
@@ -138,14 +147,15 @@ public:
 	template <typename EventType, typename UserClass, ESPMode Mode, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
 	inline FDelegateHandle Register(
 		const TSharedPtr<UserClass, Mode>& InTarget,
-		typename EventType::template TSPMemberFunctionEventObserverType<UserClass, Mode>::MemberFunctionType InFunc
+		typename EventType::template TSPMemberFunctionEventObserverType<UserClass, Mode>::MemberFunctionType InFunc,
+		const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions()
 	)
 	{
 		static_assert(!UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "You cannot use UObject method in this method.");
 		checkSlow(InTarget);
 
 		typename EventType::template TSPMemberFunctionEventObserverType<UserClass, Mode> Observer(InTarget, InFunc);
-		return RegisterImpl<EventType>(&Observer);
+		return RegisterImpl<EventType>(&Observer, InOptions);
 	}
 
 	template <typename EventType, typename UserClass, ESPMode Mode, typename TEnableIf<!TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
@@ -169,14 +179,15 @@ public:
 	template <typename EventType, typename UserClass, typename TEnableIf<TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
 	inline FDelegateHandle Register(
 		UserClass* InTarget,
-		typename EventType::template TObjectMemberFunctionEventObserverType<UserClass>::MemberFunctionType InFunc
+		typename EventType::template TObjectMemberFunctionEventObserverType<UserClass>::MemberFunctionType InFunc,
+		const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions()
 	)
 	{
 		static_assert(UE::GlobalEvents::Details::IsUObjectPtr((UserClass*)nullptr), "You can only use UObject method in this method.");
 		checkSlow(InTarget);
 
 		typename EventType::template TObjectMemberFunctionEventObserverType<UserClass> Observer(InTarget, InFunc);
-		return RegisterImpl<EventType>(&Observer);
+		return RegisterImpl<EventType>(&Observer, InOptions);
 	}
 
 	template <typename EventType, typename UserClass, typename TEnableIf<TIsDerivedFrom<UserClass, UObject>::Value, int>::Type = 0>
@@ -200,11 +211,11 @@ public:
 	*	inline bool UnRegister(const FName& InEventName, FDelegateHandle InHandle)
 	*/
 	template <typename EventType, typename FunctorType, typename TEnableIf<TIsClass<FunctorType>::Value, int>::Type = 0>
-	inline FDelegateHandle Register(FunctorType&& InFunctor)
+	inline FDelegateHandle Register(FunctorType&& InFunctor, const FGlobalEventObserverOptions& InOptions = FGlobalEventObserverOptions())
 	{
 		typename EventType::template TFunctorEventObserverType<FunctorType> Observer(MoveTemp(InFunctor));
 
-		return RegisterImpl<EventType>(&Observer);
+		return RegisterImpl<EventType>(&Observer, InOptions);
 	}
 
 	// for Unreal UFunction
@@ -228,16 +239,104 @@ public:
 	* This will provide stricter compile-time checks for the entire system. 
 	* It can also allow some implicit type conversions. 
 	* For example, const TCHAR* can be used as FString, but other interfaces cannot.
+	* Events defined by DEFINE_COALESCED_TYPESAFE_GLOBAL_EVENT are only broadcast by the next flush.
+	* Arguments passed as rvalues are moved into the last observer which can take them.
 	*/
 	template <typename EventType, typename... ParamTypes>
 	inline bool Broadcast(ParamTypes&&... InParams)
 	{
-		auto* Ptr = EventMaps.Find(EventType::GetEventName());
+		if constexpr (EventType::Coalescing != EGlobalEventCoalescing::None)
+		{
+			return Coalesce<EventType>(Forward<ParamTypes>(InParams)...);
+		}
+		else
+		{
+			return BroadcastNow<EventType>(EventType::FParamOwnershipType::template From<ParamTypes...>(), InParams...);
+		}
+	}
+
+	template <typename EventType>
+	inline bool HasListeners() const
+	{
+		if (bConcurrentMode)
+		{
+			UE::GlobalEvents::Details::FReadScope ReadScope;
+
+			return HasListenersOnSignal(FindPublishedTypeSafeSignal<EventType>());
+		}
+
+		const int32 EventId = EventType::GetEventId();
+
+		if (TypeSafeSlotIndices.IsValidIndex(EventId) && TypeSafeSlotIndices[EventId] != INDEX_NONE)
+		{
+			return HasListenersOnSignal(EventSlots[TypeSafeSlotIndices[EventId]].Signal.Get());
+		}
+
+		return HasListeners(EventType::GetEventName());
+	}
+
+	/*
+	* Broadcast an event whose parameters are only built when someone listens, see HasListeners.
+	* InPayload returns the parameter of the event, or a TTuple of them when the event has several parameters.
+	*/
+	template <typename EventType, typename PayloadFunctorType>
+	inline bool BroadcastLazy(PayloadFunctorType&& InPayload)
+	{
+		if (!HasListeners<EventType>())
+		{
+			return false;
+		}
 
+		using FPayloadResultType = typename TDecay<decltype(InPayload())>::Type;
+
+		if constexpr (TIsTuple<FPayloadResultType>::Value)
+		{
+			FPayloadResultType Payload = InPayload();
+
+			// the payload is a local, so its values are moved to the observers
+			return Payload.ApplyAfter([this](auto&... InParams)
+			{
+				return this->template Broadcast<EventType>(MoveTemp(InParams)...);
+			});
+		}
+		else
+		{
+			return Broadcast<EventType>(InPayload());
+		}
+	}
+
+private:
+	template <typename EventType, typename... ParamTypes>
+	inline bool BroadcastNow(UE::GlobalEvents::Details::EEventParamOwnership InOwnership, ParamTypes&&... InParams)
+	{
+		if (bConcurrentMode)
+		{
+			UE::GlobalEvents::Details::FReadScope ReadScope;
+
+			return BroadcastTypeSafeToSignal<EventType>(FindPublishedTypeSafeSignal<EventType>(), InOwnership, InParams...);
+		}
+
+		// observers may clear this event during dispatch, keep the signal alive
+		const FSignalPtr Signal = PinSignal(FindTypeSafeSignal<EventType>());
+
+		return BroadcastTypeSafeToSignal<EventType>(Signal.Get(), InOwnership, InParams...);
+	}
+
+	template <typename EventType, typename... ParamTypes>
+	inline bool BroadcastTypeSafeToSignal(UE::GlobalEvents::ISignal* InSignal, UE::GlobalEvents::Details::EEventParamOwnership InOwnership, ParamTypes&&... InParams)
+	{
 		using FInvokerBridgeType = typename EventType::FInvokerType;
-		if (Ptr != nullptr)
+		if (InSignal != nullptr)
 		{
-			if (!FInvokerBridgeType::Invoke(*Ptr, EventType::GetEventName(), InParams...))
+#ifdef ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
+			// OnReceiveGlobalEvent reads the values after the observers
+			if (OnReceiveGlobalEvent.IsBound() && IsInGameThread())
+			{
+				InOwnership = UE::GlobalEvents::Details::EEventParamOwnership::Borrowed;
+			}
+#endif
+
+			if (!FInvokerBridgeType::Invoke(InSignal, EventType::GetEventName(), InOwnership, InParams...))
 			{
 				return false;
 			}
@@ -251,11 +350,15 @@ public:
             * Then you need to define this macro: 
                   ENABLE_EVENT_CENTER_ON_RECEIVE_GLOBAL_EVENT
             */
-			if (OnReceiveGlobalEvent.IsBound())
+			// blueprint delegates are game thread only
+			if (OnReceiveGlobalEvent.IsBound() && IsInGameThread())
 			{
-				UDynamicEventContext* Context = EventType::FDynamicEventContextFactory::NewContext(InParams...);
+				UDynamicEventContext* Context = AcquireDynamicEventContext();
+				EventType::FDynamicEventContextFactory::Fill(Context, InParams...);
 
 				OnReceiveGlobalEvent.Broadcast(EventType::GetEventName(), Context);
+
+				ReleaseDynamicEventContext(Context);
 			}
 #endif
 
@@ -56,6 +56,8 @@ namespace UE
             virtual bool IsEmpty() const = 0;
             virtual int  Num() const = 0;
 
+            // dynamic signals can't copy a raw buffer, so there observers bound to another thread are called inline on the caller thread,
+            // use FBaseDynamicSignal::RaiseDynamicEvent to honour their thread affinity
             virtual void ExecuteRaiseEvent(const void* InParams) = 0;
         };
     }
@@ -44,6 +44,9 @@ namespace UE
             virtual const FName& GetName() const = 0;
             virtual bool IsValid() const = 0;
 
+            // dense id of the parameter list, signatures are equal if and only if their ids are equal
+            virtual int32 GetId() const = 0;
+
             // Check whether the two signatures are exactly the same
             virtual bool EqualTo(const ISignature* InOtherSignature) const = 0;
 
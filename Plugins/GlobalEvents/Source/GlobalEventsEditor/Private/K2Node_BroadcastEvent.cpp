@@ -31,13 +31,16 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "KismetNodes/SGraphNodeK2Base.h"
 #include "GraphEditorSettings.h"
-#include "K2Node_GenericCreateObject.h"
 #include "DynamicEventContext.h"
 #include "KismetCompiler.h"
 #include "K2Node_CallFunction.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_TemporaryVariable.h"
+#include "K2Node_AssignmentStatement.h"
 #include "DynamicEventFunctionLibrary.h"
 #include "GlobalEventsLog.h"
 #include "ToolMenu.h"
+#include "Runtime/Launch/Resources/Version.h"
 
 class SGraphNodeBroadcastScriptEvent : public SGraphNodeK2Base
 {
@@ -346,24 +349,91 @@ void UK2Node_BroadcastEvent::AllocateDynamicPins()
    
 }
 
-void UK2Node_BroadcastEvent::ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+FString UK2Node_BroadcastEvent::GetCallSiteName() const
 {
-    Super::ExpandNode(CompilerContext, SourceGraph);
+    return FString::Printf(TEXT("%s:%s"), *GetBlueprint()->GetPathName(), *NodeGuid.ToString());
+}
+
+UK2Node_CallFunction* UK2Node_BroadcastEvent::ExpandToVariadicCall(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* InExecPin)
+{
+    const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+
+    // one native call reads all parameters from the frame, no context object is involved
+    UK2Node_CallFunction* CallSendEventNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    CallSendEventNode->NodePosX = NodePosX;
+    CallSendEventNode->NodePosY = NodePosY;
+    CallSendEventNode->SetFromFunction(
+        UDynamicEventFunctionLibrary::StaticClass()->FindFunctionByName(
+            GET_FUNCTION_NAME_CHECKED(UDynamicEventFunctionLibrary, BroadcastEventWithParams)
+        )
+    );
+    CallSendEventNode->AllocateDefaultPins();
+
+    CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CallSendEventNode, this);
+
+    Schema->TryCreateConnection(InExecPin, CallSendEventNode->GetExecPin());
+
+    UEdGraphPin* CallSitePin = CallSendEventNode->FindPin(TEXT("CallSite"), EGPD_Input);
+    check(CallSitePin != nullptr);
+
+    Schema->TrySetDefaultValue(*CallSitePin, GetCallSiteName());
+
+    for (UEdGraphPin* Pin : Pins)
+    {
+        if (IsDefaultPin(Pin))
+        {
+            continue;
+        }
+
+        // variadic parameters are pushed in pin order
+        UEdGraphPin* VariadicPin = CallSendEventNode->CreatePin(EGPD_Input, Pin->PinType, Pin->PinName);
+        check(VariadicPin != nullptr);
+
+        CompilerContext.MovePinLinksToIntermediate(*Pin, *VariadicPin);
+    }
 
+    return CallSendEventNode;
+}
+
+UK2Node_CallFunction* UK2Node_BroadcastEvent::ExpandToContextCalls(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* InExecPin)
+{
     const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
 
-    UK2Node_GenericCreateObject* CreateNode = CompilerContext.SpawnIntermediateNode<UK2Node_GenericCreateObject>(this, SourceGraph);
+    // the context comes from the pool of the event subsystem, BroadcastEvent returns it
+    UK2Node_CallFunction* CreateNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
     CreateNode->NodePosX = NodePosX;
     CreateNode->NodePosY = NodePosY;
+    CreateNode->SetFromFunction(
+        UDynamicEventFunctionLibrary::StaticClass()->FindFunctionByName(
+            GET_FUNCTION_NAME_CHECKED(UDynamicEventFunctionLibrary, AcquireEventContext)
+        )
+    );
     CreateNode->AllocateDefaultPins();
-    
-    Schema->TrySetDefaultObject(*CreateNode->GetClassPin(), UDynamicEventContext::StaticClass());
 
     CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CreateNode, this);
 
-    CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *CreateNode->GetExecPin());
+    Schema->TryCreateConnection(InExecPin, CreateNode->GetExecPin());
 
-    UK2Node* PreviousNode = CreateNode;
+    // name this node as the call site so the context is sized with the layout of its last broadcast
+    UK2Node_CallFunction* BeginCallSiteNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    BeginCallSiteNode->SetFromFunction(
+        UDynamicEventContext::StaticClass()->FindFunctionByName(
+            GET_FUNCTION_NAME_CHECKED(UDynamicEventContext, BeginCallSite)
+        )
+    );
+    BeginCallSiteNode->AllocateDefaultPins();
+
+    CompilerContext.MessageLog.NotifyIntermediateObjectCreation(BeginCallSiteNode, this);
+
+    Schema->TryCreateConnection(CreateNode->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output), BeginCallSiteNode->GetExecPin());
+    Schema->TryCreateConnection(CreateNode->GetReturnValuePin(), Schema->FindSelfPin(*BeginCallSiteNode, EGPD_Input));
+
+    UEdGraphPin* CallSitePin = BeginCallSiteNode->FindPin(TEXT("CallSite"), EGPD_Input);
+    check(CallSitePin != nullptr);
+
+    Schema->TrySetDefaultValue(*CallSitePin, GetCallSiteName());
+
+    UK2Node* PreviousNode = BeginCallSiteNode;
 
     UFunction* AddParamFunction = UDynamicEventFunctionLibrary::StaticClass()->FindFunctionByName(UDynamicEventFunctionLibrary::PushDynamicEventFunctionName);
 
@@ -387,7 +457,7 @@ void UK2Node_BroadcastEvent::ExpandNode(class FKismetCompilerContext& CompilerCo
         UEdGraphPin* ContextPin = CallFunctionNode->FindPin(TEXT("Context"), EGPD_Input);
         check(ContextPin != nullptr);
 
-        Schema->TryCreateConnection(CreateNode->GetResultPin(), ContextPin);
+        Schema->TryCreateConnection(CreateNode->GetReturnValuePin(), ContextPin);
 
         UEdGraphPin* ValuePin = CallFunctionNode->FindPin(TEXT("Value"), EGPD_Input);
         check(ValuePin != nullptr);
@@ -418,32 +488,100 @@ void UK2Node_BroadcastEvent::ExpandNode(class FKismetCompilerContext& CompilerCo
     UEdGraphPin* ContextPin = CallSendEventNode->FindPin(TEXT("Context"));
     check(ContextPin != nullptr);
 
-    Schema->TryCreateConnection(CreateNode->GetResultPin(), ContextPin);
-    
+    Schema->TryCreateConnection(CreateNode->GetReturnValuePin(), ContextPin);
+
+    return CallSendEventNode;
+}
+
+void UK2Node_BroadcastEvent::ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+    Super::ExpandNode(CompilerContext, SourceGraph);
+
+    const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+
+    // nothing of the broadcast runs when nobody listens, the parameter pins are not even evaluated
+    UK2Node_CallFunction* HasListenersNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    HasListenersNode->SetFromFunction(
+        UDynamicEventFunctionLibrary::StaticClass()->FindFunctionByName(
+            GET_FUNCTION_NAME_CHECKED(UDynamicEventFunctionLibrary, HasGlobalEventListeners)
+        )
+    );
+    HasListenersNode->AllocateDefaultPins();
+
+    CompilerContext.MessageLog.NotifyIntermediateObjectCreation(HasListenersNode, this);
+
+    UK2Node_IfThenElse* BranchNode = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+    BranchNode->AllocateDefaultPins();
+
+    CompilerContext.MessageLog.NotifyIntermediateObjectCreation(BranchNode, this);
+
+    CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *BranchNode->GetExecPin());
+    Schema->TryCreateConnection(HasListenersNode->GetReturnValuePin(), BranchNode->GetConditionPin());
+
+    // variadic native functions are available since UE5, older engines fill a context node by node
+#if ENGINE_MAJOR_VERSION >= 5
+    UK2Node_CallFunction* CallSendEventNode = ExpandToVariadicCall(CompilerContext, SourceGraph, BranchNode->GetThenPin());
+#else
+    UK2Node_CallFunction* CallSendEventNode = ExpandToContextCalls(CompilerContext, SourceGraph, BranchNode->GetThenPin());
+#endif
+
     UEdGraphPin* NamePin = FindPin(EVENT_NAME);
     checkSlow(NamePin);
 
     UEdGraphPin* EventNamePin = CallSendEventNode->FindPin(EVENT_NAME);
     check(EventNamePin!= nullptr);
 
+    UEdGraphPin* HasListenersNamePin = HasListenersNode->FindPin(EVENT_NAME);
+    check(HasListenersNamePin != nullptr);
+
     if (NamePin->LinkedTo.Num() > 0)
     {        
+        CompilerContext.CopyPinLinksToIntermediate(*NamePin, *HasListenersNamePin);
         CompilerContext.MovePinLinksToIntermediate(*NamePin, *EventNamePin);
     }
     else
     {
+        Schema->TrySetDefaultValue(*HasListenersNamePin, NamePin->GetDefaultAsString());
         Schema->TrySetDefaultValue(*EventNamePin, NamePin->GetDefaultAsString());
     }
 
+    // both paths write the result, a skipped broadcast returns false
+    UK2Node_TemporaryVariable* ResultVariableNode = CompilerContext.SpawnInternalVariable(this, UEdGraphSchema_K2::PC_Boolean);
+
+    UK2Node_AssignmentStatement* AssignResultNode = CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+    AssignResultNode->AllocateDefaultPins();
+
+    CompilerContext.MessageLog.NotifyIntermediateObjectCreation(AssignResultNode, this);
+
+    Schema->TryCreateConnection(ResultVariableNode->GetVariablePin(), AssignResultNode->GetVariablePin());
+    AssignResultNode->NotifyPinConnectionListChanged(AssignResultNode->GetVariablePin());
+
     UEdGraphPin* ResultValuePin = CallSendEventNode->FindPin(UEdGraphSchema_K2::PN_ReturnValue);
     check(ResultValuePin);
 
+    Schema->TryCreateConnection(ResultValuePin, AssignResultNode->GetValuePin());
+    Schema->TryCreateConnection(CallSendEventNode->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output), AssignResultNode->GetExecPin());
+
+    UK2Node_AssignmentStatement* AssignSkippedNode = CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+    AssignSkippedNode->AllocateDefaultPins();
+
+    CompilerContext.MessageLog.NotifyIntermediateObjectCreation(AssignSkippedNode, this);
+
+    Schema->TryCreateConnection(ResultVariableNode->GetVariablePin(), AssignSkippedNode->GetVariablePin());
+    AssignSkippedNode->NotifyPinConnectionListChanged(AssignSkippedNode->GetVariablePin());
+
+    Schema->TrySetDefaultValue(*AssignSkippedNode->GetValuePin(), TEXT("false"));
+    Schema->TryCreateConnection(BranchNode->GetElsePin(), AssignSkippedNode->GetExecPin());
+
     UEdGraphPin* ThisResultPin = FindPin(RESULT_NAME);
     check(ThisResultPin);
 
-    CompilerContext.MovePinLinksToIntermediate(*ThisResultPin, *ResultValuePin);
+    CompilerContext.MovePinLinksToIntermediate(*ThisResultPin, *ResultVariableNode->GetVariablePin());
+
+    UEdGraphPin* ThisThenPin = UK2Node::FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output);
 
-    CompilerContext.MovePinLinksToIntermediate(*UK2Node::FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output), *CallSendEventNode->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output));
+    CompilerContext.CopyPinLinksToIntermediate(*ThisThenPin, *AssignSkippedNode->GetThenPin());
+    CompilerContext.MovePinLinksToIntermediate(*ThisThenPin, *AssignResultNode->GetThenPin());
 
     // remove all 
     BreakAllNodeLinks();
@@ -65,5 +65,12 @@ public:
     
 private:
     void AllocateDynamicPins();
+
+    // names this node in the layout cache of the dynamic tuples
+    FString GetCallSiteName() const;
+
+    // both start from InExecPin and return the node that broadcasts the event
+    class UK2Node_CallFunction* ExpandToVariadicCall(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* InExecPin);
+    class UK2Node_CallFunction* ExpandToContextCalls(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* InExecPin);
 };
 
@@ -4,7 +4,12 @@
 #include "GameEventTestsSubsystem.h"
 #include "GameEventSubsystem.h"
 #include "Details/Signature.h"
+#include "Details/EventQueue.h"
 #include "DynamicEventContext.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include <atomic>
 
 static_assert(!UE::GlobalEvents::Details::TTypeInfo<UObject>::IsSupportedType(), "check");
 static_assert(UE::GlobalEvents::Details::TTypeInfo<UObject*>::IsSupportedType(), "check");
@@ -38,6 +43,9 @@ void UGameEventTestsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    // the event queue is created when the event subsystem initializes
+    Collection.InitializeDependency(UGameEventSubsystem::StaticClass());
+
     RawObjPtr = MakeShared<FRawTestsObject>();
     TestsObj = NewObject<UTestObject>();
 
@@ -49,11 +57,45 @@ void UGameEventTestsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
     TestDynamicTuple();
 
+    TestDynamicTupleAlignment();
+
     RegisterDebugEvent();
 
     SendDebugEvent();
 
     TestReferenceParameter();
+
+    TestReentrantBroadcast();
+
+    TestQueuedEvents();
+
+    TestEventQueueArena();
+
+    TestConcurrentQueuedEvents();
+
+    TestParallelDispatch();
+
+    TestThreadAffinity();
+
+    TestDynamicThreadAffinity();
+
+    TestCoalescedEvents();
+
+    TestDeferredEvents();
+
+    TestContextPool();
+
+    TestHasListeners();
+
+    TestForwardedParameters();
+
+    TestMovedParameters();
+
+    TestSignatureRegistry();
+
+    TestEventSlots();
+
+    TestTypeSafeEventIds();
 }
 
 void UGameEventTestsSubsystem::Deinitialize()
@@ -226,8 +268,59 @@ void UGameEventTestsSubsystem::TestDynamicTuple()
         _CheckOffset(12);
         _CheckOffset(13);
         _CheckOffset(14);
+
+        check(Context->Get<FString>(5) == Tuples.Get<5>());
+        check(Context->Get<TArray<int>>(12) == Tuples.Get<12>());
+        check(Context->Get<TMap<int, FName>>(14)[100] == TEXT("100"));
+    }
+
+    {
+        // temporaries are moved into the tuple, lvalues are copied
+        FString Moved = TEXT("moved into the tuple");
+        FString Copied = TEXT("copied into the tuple");
+
+        UE::GlobalEvents::FDynamicTuple Tuple;
+        Tuple.Push(MoveTemp(Moved));
+        Tuple.Push(Copied);
+
+        check(Moved.IsEmpty());
+        check(Tuple.Get<FString>(0) == TEXT("moved into the tuple"));
+        check(Tuple.Get<FString>(1) == Copied);
+
+        // small tuples stay in the inline buffer
+        check((const uint8*)Tuple.GetData() >= (const uint8*)&Tuple && (const uint8*)Tuple.GetData() < (const uint8*)(&Tuple + 1));
+    }
+
+    {
+        // precomputed layouts match TTuple and the pushed elements
+        using FLayout = UE::GlobalEvents::Details::TDynamicTupleLayout<bool, FString, int64, FVector, TArray<int>>;
+
+        TTuple<bool, FString, int64, FVector, TArray<int>> Tuples;
+
+        check(FLayout::Get().Num() == 5);
+        check(FLayout::Get().GetOffset(1) == (uint32)((uint8*)&Tuples.Get<1>() - (uint8*)&Tuples));
+        check(FLayout::Get().GetOffset(3) == (uint32)((uint8*)&Tuples.Get<3>() - (uint8*)&Tuples));
+        check(FLayout::Get().GetOffset(4) == (uint32)((uint8*)&Tuples.Get<4>() - (uint8*)&Tuples));
+
+        UE::GlobalEvents::FDynamicTuple Tuple;
+        Tuple.Reserve(FLayout::Get());
+
+        const void* Data = Tuple.GetData();
+
+        Tuple.Push(Tuples.Get<0>());
+        Tuple.Push(Tuples.Get<1>());
+        Tuple.Push(Tuples.Get<2>());
+        Tuple.Push(Tuples.Get<3>());
+        Tuple.Push(Tuples.Get<4>());
+
+        check(Tuple.GetData() == Data);
+        check(Tuple.GetLayout().GetSize() == FLayout::Get().GetSize());
+
+        // the lazily built name matches the one of the static signature
+        const UE::GlobalEvents::ISignature* StaticSignature = UE::GlobalEvents::Details::TGenericSignature<bool, FString, int64, FVector, TArray<int>>::StaticSignature();
+        check(Tuple.GetSignature()->EqualTo(StaticSignature));
+        check(Tuple.GetSignature()->GetName() == StaticSignature->GetName());
     }
-    
 }
 
 void UGameEventTestsSubsystem::RegisterDebugEvent()
@@ -396,6 +489,36 @@ void UGameEventTestsSubsystem::SendDebugEvent()
 
 }
 
+void UGameEventTestsSubsystem::TestDynamicTupleAlignment()
+{
+    constexpr uint32 OverAlignment = alignof(FTestOverAlignedStruct);
+    static_assert(OverAlignment > UE::GlobalEvents::FDynamicTuple::InlineAlignment, "the struct must need more than the inline alignment");
+
+    FTestOverAlignedStruct OverAligned;
+    OverAligned.Value = 7;
+
+    UE::GlobalEvents::FDynamicTuple Tuple;
+    Tuple.Push(FTestOverAlignedStruct::StaticStruct(), &OverAligned);
+    check(IsAligned(Tuple.GetAddress(0), OverAlignment));
+
+    // the less aligned elements outgrow the buffer, it must keep the alignment of the first element when it is reallocated
+    constexpr int NumStrings = 64;
+
+    for (int i = 0; i < NumStrings; ++i)
+    {
+        Tuple.Push(FString::FromInt(i));
+
+        check(IsAligned(Tuple.GetAddress(0), OverAlignment));
+    }
+
+    check(((const FTestOverAlignedStruct*)Tuple.GetAddress(0))->Value == 7);
+
+    for (int i = 0; i < NumStrings; ++i)
+    {
+        check(Tuple.Get<FString>(i + 1) == FString::FromInt(i));
+    }
+}
+
 DEFINE_TYPESAFE_GLOBAL_EVENT(TestReferenceEvent, bool, bool&, FString, FString&, FVector, FVector&);
 
 void UGameEventTestsSubsystem::TestReferenceParameter()
@@ -437,3 +560,878 @@ void UGameEventTestsSubsystem::TestReferenceParameter()
 
     EventCenter->ClearEventObservers<FTestReferenceEvent>();
 }
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestReentrantEvent, int);
+
+void UGameEventTestsSubsystem::TestReentrantBroadcast()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    int NumCalls = 0, NumLateCalls = 0, NumRemovedCalls = 0;
+    FDelegateHandle RemovedHandle;
+
+    EventCenter->Register<FTestReentrantEvent>([&](int InDepth)
+        {
+            ++NumCalls;
+
+            if (InDepth == 0)
+            {
+                // connected during dispatch, only the nested broadcasts see it
+                EventCenter->Register<FTestReentrantEvent>([&](int) { ++NumLateCalls; });
+
+                // removed during dispatch, must not be called even by the outer broadcast
+                EventCenter->UnRegister(FTestReentrantEvent::GetEventName(), RemovedHandle);
+            }
+
+            if (InDepth < 3)
+            {
+                EventCenter->Broadcast<FTestReentrantEvent>(InDepth + 1);
+            }
+        });
+
+    RemovedHandle = EventCenter->Register<FTestReentrantEvent>([&](int) { ++NumRemovedCalls; });
+
+    EventCenter->Broadcast<FTestReentrantEvent>(0);
+
+    check(NumCalls == 4);
+    check(NumLateCalls == 3);
+    check(NumRemovedCalls == 0);
+
+    EventCenter->ClearEventObservers<FTestReentrantEvent>();
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestQueuedEvent, int, const FString&);
+
+void UGameEventTestsSubsystem::TestQueuedEvents()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    constexpr int NumEvents = 16;
+    TArray<int> Received;
+
+    EventCenter->Register<FTestQueuedEvent>([&](int InValue, const FString& InText)
+        {
+            check(IsInGameThread());
+            check(InText == FString::FromInt(InValue));
+
+            Received.Add(InValue);
+        });
+
+    // events of a worker thread keep their order
+    Async(EAsyncExecution::Thread, [&]()
+        {
+            for (int i = 0; i < NumEvents; ++i)
+            {
+                EventCenter->Enqueue<FTestQueuedEvent>(i, FString::FromInt(i));
+            }
+        }).Wait();
+
+    EventCenter->Enqueue(FTestQueuedEvent::GetEventName(), NumEvents, FString::FromInt(NumEvents));
+
+    // nothing is delivered before the flush
+    check(Received.Num() == 0);
+
+    verify(EventCenter->FlushQueuedEvents() == NumEvents + 1);
+    check(Received.Num() == NumEvents + 1);
+
+    for (int i = 0; i <= NumEvents; ++i)
+    {
+        check(Received[i] == i);
+    }
+
+    verify(EventCenter->FlushQueuedEvents() == 0);
+
+    EventCenter->ClearEventObservers<FTestQueuedEvent>();
+}
+
+namespace
+{
+    struct FQueueArenaTestState
+    {
+        TArray<int32> NextSequences;
+        int32 NumEvents = 0;
+    };
+
+    // the bytes of the payload depend on its sequence, so a payload overwritten in the arena is detected
+    template <int32 Size>
+    struct TQueueArenaTestPayload
+    {
+        int32 Producer;
+        int32 Sequence;
+        uint8 Bytes[Size];
+
+        TQueueArenaTestPayload(int32 InProducer, int32 InSequence) :
+            Producer(InProducer),
+            Sequence(InSequence)
+        {
+            for (int32 i = 0; i < Size; ++i)
+            {
+                Bytes[i] = (uint8)(InSequence + i);
+            }
+        }
+
+        static void Dispatch(void* InContext, void* InPayload)
+        {
+            FQueueArenaTestState* State = (FQueueArenaTestState*)InContext;
+            const TQueueArenaTestPayload* Payload = (const TQueueArenaTestPayload*)InPayload;
+
+            for (int32 i = 0; i < Size; ++i)
+            {
+                check(Payload->Bytes[i] == (uint8)(Payload->Sequence + i));
+            }
+
+            // events of one producer are drained in order
+            check(Payload->Sequence == State->NextSequences[Payload->Producer]);
+
+            ++State->NextSequences[Payload->Producer];
+            ++State->NumEvents;
+        }
+    };
+
+    void EnqueueArenaTestPayload(UE::GlobalEvents::Details::FEventQueue& InQueue, int32 InProducer, int32 InSequence)
+    {
+        // the last size doesn't fit in a quarter of the arena and goes to the heap
+        switch (InSequence % 4)
+        {
+        case 0:
+            InQueue.Emplace<TQueueArenaTestPayload<8>>(&TQueueArenaTestPayload<8>::Dispatch, InProducer, InSequence);
+            break;
+        case 1:
+            InQueue.Emplace<TQueueArenaTestPayload<56>>(&TQueueArenaTestPayload<56>::Dispatch, InProducer, InSequence);
+            break;
+        case 2:
+            InQueue.Emplace<TQueueArenaTestPayload<120>>(&TQueueArenaTestPayload<120>::Dispatch, InProducer, InSequence);
+            break;
+        default:
+            InQueue.Emplace<TQueueArenaTestPayload<400>>(&TQueueArenaTestPayload<400>::Dispatch, InProducer, InSequence);
+            break;
+        }
+    }
+}
+
+void UGameEventTestsSubsystem::TestEventQueueArena()
+{
+    using namespace UE::GlobalEvents::Details;
+
+    // a small arena wraps around many times
+    FEventQueue Queue(1024);
+    FQueueArenaTestState State;
+
+    constexpr int32 NumProducers = 4;
+    constexpr int32 NumEventsPerProducer = 4096;
+
+    State.NextSequences.SetNumZeroed(NumProducers + 1);
+
+    // the consumer frees the blocks in arena order
+    for (int32 i = 0; i < NumEventsPerProducer; ++i)
+    {
+        EnqueueArenaTestPayload(Queue, NumProducers, i);
+
+        if (i % 7 == 0)
+        {
+            Queue.Drain(&State);
+        }
+    }
+
+    Queue.Drain(&State);
+    check(State.NumEvents == NumEventsPerProducer);
+
+    // producers racing for the arena link their records in another order than they reserved their blocks,
+    // so the consumer frees the blocks out of order while the producers wrap around
+    std::atomic<int32> NumProducing{ NumProducers };
+    TArray<TFuture<void>> Producers;
+
+    for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+    {
+        Producers.Add(Async(EAsyncExecution::Thread, [&Queue, &NumProducing, Producer]()
+            {
+                for (int32 i = 0; i < NumEventsPerProducer; ++i)
+                {
+                    EnqueueArenaTestPayload(Queue, Producer, i);
+                }
+
+                NumProducing.fetch_sub(1, std::memory_order_release);
+            }));
+    }
+
+    while (NumProducing.load(std::memory_order_acquire) > 0)
+    {
+        Queue.Drain(&State);
+    }
+
+    for (TFuture<void>& Producer : Producers)
+    {
+        Producer.Wait();
+    }
+
+    Queue.Drain(&State);
+
+    check(Queue.IsEmpty());
+    check(State.NumEvents == NumEventsPerProducer * (NumProducers + 1));
+
+    for (int32 Producer = 0; Producer <= NumProducers; ++Producer)
+    {
+        check(State.NextSequences[Producer] == NumEventsPerProducer);
+    }
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestConcurrentQueuedEvent, int);
+
+void UGameEventTestsSubsystem::TestConcurrentQueuedEvents()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    constexpr int NumProducers = 4;
+    constexpr int NumEventsPerProducer = 10000;
+
+    int NumReceived = 0;
+
+    EventCenter->Register<FTestConcurrentQueuedEvent>([&NumReceived](int InValue)
+        {
+            ++NumReceived;
+        });
+
+    std::atomic<int> NumProducing{ NumProducers };
+    TArray<TFuture<void>> Producers;
+
+    for (int Producer = 0; Producer < NumProducers; ++Producer)
+    {
+        Producers.Add(Async(EAsyncExecution::Thread, [EventCenter, &NumProducing, Producer]()
+            {
+                for (int i = 0; i < NumEventsPerProducer; ++i)
+                {
+                    EventCenter->Enqueue<FTestConcurrentQueuedEvent>(Producer);
+                }
+
+                NumProducing.fetch_sub(1, std::memory_order_release);
+            }));
+    }
+
+    // flushing while the producers race makes the queue put its stub back behind records which are still being linked
+    while (NumProducing.load(std::memory_order_acquire) > 0)
+    {
+        EventCenter->FlushQueuedEvents();
+    }
+
+    for (TFuture<void>& Producer : Producers)
+    {
+        Producer.Wait();
+    }
+
+    // one flush after the producers have joined must deliver the end of every burst
+    EventCenter->FlushQueuedEvents();
+    check(NumReceived == NumProducers * NumEventsPerProducer);
+
+    verify(EventCenter->FlushQueuedEvents() == 0);
+
+    EventCenter->ClearEventObservers<FTestConcurrentQueuedEvent>();
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestParallelEvent, int);
+
+void UGameEventTestsSubsystem::TestParallelDispatch()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    // enough observers to fan out with the default GlobalEvents.ParallelDispatchThreshold
+    constexpr int NumConcurrentObservers = 1024;
+    constexpr int NumSerialObservers = 4;
+
+    std::atomic<int> ConcurrentSum{ 0 };
+    TArray<int> SerialOrder;
+
+    for (int i = 0; i < NumConcurrentObservers; ++i)
+    {
+        EventCenter->Register<FTestParallelEvent>([&ConcurrentSum](int InValue)
+            {
+                ConcurrentSum.fetch_add(InValue, std::memory_order_relaxed);
+            }, FGlobalEventObserverOptions::ConcurrentSafe());
+
+        // the other observers keep their order and stay on the calling thread
+        if (i % (NumConcurrentObservers / NumSerialObservers) == 0)
+        {
+            EventCenter->Register<FTestParallelEvent>([&SerialOrder, i](int InValue)
+                {
+                    check(IsInGameThread());
+
+                    SerialOrder.Add(i);
+                });
+        }
+    }
+
+    EventCenter->Broadcast<FTestParallelEvent>(2);
+
+    // every observer has been called when Broadcast returns
+    check(ConcurrentSum.load() == NumConcurrentObservers * 2);
+    check(SerialOrder.Num() == NumSerialObservers);
+
+    for (int i = 1; i < SerialOrder.Num(); ++i)
+    {
+        check(SerialOrder[i - 1] < SerialOrder[i]);
+    }
+
+    EventCenter->ClearEventObservers<FTestParallelEvent>();
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestAffinityEvent, int, const FString&);
+
+void UGameEventTestsSubsystem::TestThreadAffinity()
+{
+#if ENGINE_MAJOR_VERSION >= 5
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    UE::Tasks::FPipe Pipe(TEXT("GlobalEventsTestsPipe"));
+
+    std::atomic<int> PipeSum{ 0 };
+    int InlineValue = 0;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        EventCenter->Register<FTestAffinityEvent>([&Pipe, &PipeSum](int InValue, const FString& InText)
+            {
+                check(Pipe.IsInContext());
+                check(InText == FString::FromInt(InValue));
+
+                PipeSum.fetch_add(InValue);
+            }, FGlobalEventObserverOptions::OnPipe(Pipe));
+    }
+
+    EventCenter->Register<FTestAffinityEvent>([&InlineValue](int InValue, const FString& InText)
+        {
+            check(IsInGameThread());
+
+            InlineValue = InValue;
+        });
+
+    EventCenter->Broadcast<FTestAffinityEvent>(3, FString(TEXT("3")));
+
+    // observers without affinity are called before Broadcast returns, the pipe gets one delivery for both of its observers
+    check(InlineValue == 3);
+
+    Pipe.WaitUntilEmpty();
+    check(PipeSum.load() == 6);
+
+    EventCenter->ClearEventObservers<FTestAffinityEvent>();
+#endif
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestDynamicAffinityEvent, int, const FString&);
+
+void UGameEventTestsSubsystem::TestDynamicThreadAffinity()
+{
+#if ENGINE_MAJOR_VERSION >= 5
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    // a dynamic signal, like the one of an event first registered by a UFunction
+    UE::GlobalEvents::Details::FDynamicSignature Signature;
+    Signature.Add<int>();
+    Signature.Add<FString>();
+
+    verify(EventCenter->BindSignature(FTestDynamicAffinityEvent::GetEventName(), UE::GlobalEvents::Details::FAnonymousSignal(MoveTemp(Signature))));
+
+    UE::Tasks::FPipe Pipe(TEXT("GlobalEventsTestsDynamicPipe"));
+
+    std::atomic<int> PipeSum{ 0 };
+    int InlineValue = 0;
+
+    EventCenter->Register<FTestDynamicAffinityEvent>([&Pipe, &PipeSum](int InValue, const FString& InText)
+        {
+            check(Pipe.IsInContext());
+            check(InText == FString::FromInt(InValue));
+
+            PipeSum.fetch_add(InValue);
+        }, FGlobalEventObserverOptions::OnPipe(Pipe));
+
+    EventCenter->Register<FTestDynamicAffinityEvent>([&InlineValue](int InValue, const FString& InText)
+        {
+            check(IsInGameThread());
+
+            InlineValue = InValue;
+        });
+
+    UE::GlobalEvents::FDynamicTuple Params;
+    Params.Push(3);
+    Params.Push(FString(TEXT("3")));
+
+    // the tuple is gone when BroadcastDynamic returns, the pipe reads its own copy
+    verify(EventCenter->BroadcastDynamic(FTestDynamicAffinityEvent::GetEventName(), MoveTemp(Params)));
+    check(InlineValue == 3);
+
+    Pipe.WaitUntilEmpty();
+    check(PipeSum.load() == 3);
+
+    EventCenter->ClearEventObservers<FTestDynamicAffinityEvent>();
+#endif
+}
+
+DEFINE_COALESCED_TYPESAFE_GLOBAL_EVENT(TestCoalescedEvent, int);
+DEFINE_KEYED_COALESCED_TYPESAFE_GLOBAL_EVENT(TestKeyedCoalescedEvent, int, const FString&);
+
+void UGameEventTestsSubsystem::TestCoalescedEvents()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    TArray<int> Values;
+    TArray<FString> KeyedValues;
+
+    EventCenter->Register<FTestCoalescedEvent>([&Values](int InValue)
+        {
+            Values.Add(InValue);
+        });
+
+    EventCenter->Register<FTestKeyedCoalescedEvent>([&KeyedValues](int InKey, const FString& InValue)
+        {
+            KeyedValues.Add(FString::Printf(TEXT("%d=%s"), InKey, *InValue));
+        });
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EventCenter->Broadcast<FTestCoalescedEvent>(i);
+        EventCenter->Broadcast<FTestKeyedCoalescedEvent>(i % 2, FString::FromInt(i));
+    }
+
+    // nothing is delivered before the flush
+    check(Values.Num() == 0 && KeyedValues.Num() == 0);
+
+    verify(EventCenter->FlushCoalescedEvents() == 3);
+
+    check(Values.Num() == 1 && Values[0] == 9);
+
+    // keys keep the order of their first broadcast
+    check(KeyedValues.Num() == 2);
+    check(KeyedValues[0] == TEXT("0=8"));
+    check(KeyedValues[1] == TEXT("1=9"));
+
+    verify(EventCenter->FlushCoalescedEvents() == 0);
+
+    EventCenter->ClearEventObservers<FTestCoalescedEvent>();
+    EventCenter->ClearEventObservers<FTestKeyedCoalescedEvent>();
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestDeferredEvent, int);
+
+void UGameEventTestsSubsystem::TestDeferredEvents()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    // the test depends on which events are overdue, so it doesn't rely on the configured latencies
+    constexpr int NumPriorities = 3;
+
+    IConsoleVariable* MaxLatencyVariables[NumPriorities] =
+    {
+        IConsoleManager::Get().FindConsoleVariable(TEXT("GlobalEvents.DeferredMaxLatencyMs.High")),
+        IConsoleManager::Get().FindConsoleVariable(TEXT("GlobalEvents.DeferredMaxLatencyMs.Normal")),
+        IConsoleManager::Get().FindConsoleVariable(TEXT("GlobalEvents.DeferredMaxLatencyMs.Low"))
+    };
+
+    const float TestMaxLatencies[NumPriorities] = { 0.0f, 60000.0f, 60000.0f };
+    float SavedMaxLatencies[NumPriorities];
+
+    for (int i = 0; i < NumPriorities; ++i)
+    {
+        check(MaxLatencyVariables[i] != nullptr);
+
+        SavedMaxLatencies[i] = MaxLatencyVariables[i]->GetFloat();
+        MaxLatencyVariables[i]->Set(TestMaxLatencies[i]);
+    }
+
+    TArray<int> Received;
+
+    EventCenter->Register<FTestDeferredEvent>([&Received](int InValue)
+        {
+            Received.Add(InValue);
+        });
+
+    EventCenter->Defer<FTestDeferredEvent>(EGlobalEventPriority::Low, 2);
+    EventCenter->Defer<FTestDeferredEvent>(EGlobalEventPriority::Normal, 1);
+    EventCenter->Defer<FTestDeferredEvent>(EGlobalEventPriority::Low, 3);
+    EventCenter->Defer(FTestDeferredEvent::GetEventName(), EGlobalEventPriority::High, 0);
+
+    check(Received.Num() == 0);
+    check(EventCenter->GetNumDeferredEvents() == 4);
+
+    // high priority events with a latency of 0 are overdue at once, so they are broadcast without any budget
+    verify(EventCenter->DrainDeferredEvents(0.0) == 1);
+    check(Received.Num() == 1 && Received[0] == 0);
+
+    // then by priority, in order inside a priority
+    verify(EventCenter->DrainDeferredEvents(TNumericLimits<double>::Max()) == 3);
+    check(Received.Num() == 4);
+
+    for (int i = 0; i < Received.Num(); ++i)
+    {
+        check(Received[i] == i);
+    }
+
+    check(EventCenter->GetNumDeferredEvents() == 0);
+
+    EventCenter->ClearEventObservers<FTestDeferredEvent>();
+
+    for (int i = 0; i < NumPriorities; ++i)
+    {
+        MaxLatencyVariables[i]->Set(SavedMaxLatencies[i]);
+    }
+}
+
+void UGameEventTestsSubsystem::TestContextPool()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    UDynamicEventContext* Context = EventCenter->AcquireDynamicEventContext();
+    check(Context != nullptr && Context->Num() == 0);
+
+    // pooled contexts can be broadcast again by scripts, they resolve the subsystem through their outer
+    check(UGameEventSubsystem::GetInstance(Context) == EventCenter);
+
+    Context->Add(42);
+    Context->Add(FString(TEXT("Pooled")));
+
+    EventCenter->ReleaseDynamicEventContext(Context);
+
+    // released contexts are cleared and handed out again
+    UDynamicEventContext* Reused = EventCenter->AcquireDynamicEventContext();
+    check(Reused == Context && Reused->Num() == 0);
+
+    EventCenter->ReleaseDynamicEventContext(Reused);
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestLazyEvent, int, const FString&);
+
+void UGameEventTestsSubsystem::TestHasListeners()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    // OnReceiveGlobalEvent hears every event which has a signal, unbind it to count the observers only
+    EventCenter->OnReceiveGlobalEvent.RemoveDynamic(this, &UGameEventTestsSubsystem::OnGlobalEventReceived);
+
+    int NumPayloads = 0;
+    auto MakePayload = [&NumPayloads]()
+        {
+            ++NumPayloads;
+
+            return MakeTuple(7, FString(TEXT("Lazy")));
+        };
+
+    check(!EventCenter->HasListeners<FTestLazyEvent>());
+    check(!EventCenter->BroadcastLazy<FTestLazyEvent>(MakePayload));
+    check(NumPayloads == 0);
+
+    int NumReceived = 0;
+    auto Observer = [&NumReceived](int InValue, const FString& InText)
+        {
+            check(InValue == 7 && InText == TEXT("Lazy"));
+
+            ++NumReceived;
+        };
+
+    const FDelegateHandle First = EventCenter->Register<FTestLazyEvent>(CopyTemp(Observer));
+    const FDelegateHandle Second = EventCenter->Register<FTestLazyEvent>(CopyTemp(Observer));
+
+    check(EventCenter->HasListeners<FTestLazyEvent>());
+    check(EventCenter->HasListeners(FTestLazyEvent::GetEventName()));
+    check(EventCenter->HasListeners(EventCenter->ResolveEventSlot(FTestLazyEvent::GetEventName())));
+
+    check(EventCenter->BroadcastLazy<FTestLazyEvent>(MakePayload));
+    check(NumPayloads == 1 && NumReceived == 2);
+
+    // the signal outlives its observers, only the live ones count
+    verify(EventCenter->UnRegister(FTestLazyEvent::GetEventName(), First));
+    check(EventCenter->HasListeners<FTestLazyEvent>());
+
+    verify(EventCenter->UnRegister(FTestLazyEvent::GetEventName(), Second));
+    check(!EventCenter->HasListeners<FTestLazyEvent>());
+
+    check(!EventCenter->BroadcastLazy<FTestLazyEvent>(MakePayload));
+    check(NumPayloads == 1 && NumReceived == 2);
+
+    EventCenter->ClearEventObservers<FTestLazyEvent>();
+
+    EventCenter->OnReceiveGlobalEvent.AddDynamic(this, &UGameEventTestsSubsystem::OnGlobalEventReceived);
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestContainerEvent, TArray<FString>);
+
+void UGameEventTestsSubsystem::TestForwardedParameters()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    TArray<FString> Strings;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        Strings.Add(FString::FromInt(i));
+    }
+
+    int NumByReference = 0;
+    int NumByValue = 0;
+
+    // an observer taking a reference sees the array of the broadcast, nothing is copied on the way
+    EventCenter->Register<FTestContainerEvent>([&Strings, &NumByReference](const TArray<FString>& InStrings)
+        {
+            check(InStrings.GetData() == Strings.GetData());
+
+            ++NumByReference;
+        });
+
+    // an observer taking a value gets its own copy
+    EventCenter->Register<FTestContainerEvent>([&Strings, &NumByValue](TArray<FString> InStrings)
+        {
+            check(InStrings.GetData() != Strings.GetData() && InStrings == Strings);
+
+            ++NumByValue;
+        });
+
+    verify(EventCenter->Broadcast<FTestContainerEvent>(Strings));
+    verify(EventCenter->Broadcast(FTestContainerEvent::GetEventName(), Strings));
+    verify(EventCenter->Broadcast(EventCenter->ResolveEventSlot(FTestContainerEvent::GetEventName()), Strings));
+
+    check(NumByReference == 3 && NumByValue == 3);
+
+    EventCenter->ClearEventObservers<FTestContainerEvent>();
+}
+
+void UGameEventTestsSubsystem::TestMovedParameters()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    // OnReceiveGlobalEvent reads the values after the observers, nothing is moved while it is bound
+    EventCenter->OnReceiveGlobalEvent.RemoveDynamic(this, &UGameEventTestsSubsystem::OnGlobalEventReceived);
+
+    TArray<FString> Strings;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        Strings.Add(FString::FromInt(i));
+    }
+
+    const FString* SentData = nullptr;
+    const FString* ReceivedData = nullptr;
+    int NumByReference = 0;
+
+    auto MakeValueObserver = [&ReceivedData]()
+    {
+        return [&ReceivedData](TArray<FString> InStrings)
+        {
+            check(InStrings.Num() == 1000);
+
+            ReceivedData = InStrings.GetData();
+        };
+    };
+
+    // a single observer taking a value gets the array of an rvalue broadcast
+    EventCenter->Register<FTestContainerEvent>(MakeValueObserver());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        TArray<FString> Payload = Strings;
+        SentData = Payload.GetData();
+
+        if (i == 0)
+        {
+            verify(EventCenter->Broadcast<FTestContainerEvent>(MoveTemp(Payload)));
+        }
+        else if (i == 1)
+        {
+            verify(EventCenter->Broadcast(FTestContainerEvent::GetEventName(), MoveTemp(Payload)));
+        }
+        else
+        {
+            verify(EventCenter->Broadcast(EventCenter->ResolveEventSlot(FTestContainerEvent::GetEventName()), MoveTemp(Payload)));
+        }
+
+        check(ReceivedData == SentData);
+    }
+
+    // the caller keeps an lvalue, the observer gets a copy
+    verify(EventCenter->Broadcast<FTestContainerEvent>(Strings));
+    check(ReceivedData != Strings.GetData() && Strings.Num() == 1000);
+
+    // observers in front of the last one still see the values
+    EventCenter->ClearEventObservers<FTestContainerEvent>();
+
+    EventCenter->Register<FTestContainerEvent>([&SentData, &NumByReference](const TArray<FString>& InStrings)
+        {
+            check(InStrings.GetData() == SentData && InStrings.Num() == 1000);
+
+            ++NumByReference;
+        });
+    EventCenter->Register<FTestContainerEvent>(MakeValueObserver());
+
+    {
+        TArray<FString> Payload = Strings;
+        SentData = Payload.GetData();
+
+        verify(EventCenter->Broadcast<FTestContainerEvent>(MoveTemp(Payload)));
+        check(NumByReference == 1 && ReceivedData == SentData);
+    }
+
+    EventCenter->ClearEventObservers<FTestContainerEvent>();
+
+    EventCenter->OnReceiveGlobalEvent.AddDynamic(this, &UGameEventTestsSubsystem::OnGlobalEventReceived);
+}
+
+void UGameEventTestsSubsystem::TestSignatureRegistry()
+{
+    using namespace UE::GlobalEvents::Details;
+
+    const int32 IntId = TGenericSignature<int>::StaticSignature()->GetId();
+    const int32 FloatId = TGenericSignature<float>::StaticSignature()->GetId();
+    const int32 ObjectId = TGenericSignature<UObject*>::StaticSignature()->GetId();
+    const int32 TestObjectId = TGenericSignature<UTestObject*>::StaticSignature()->GetId();
+
+    // references and constness don't make another signature
+    check(TGenericSignature<const int&>::StaticSignature()->GetId() == IntId);
+    check(IntId != FloatId && ObjectId != TestObjectId);
+
+    auto CheckVerdicts = [&]()
+    {
+        // asked twice, the second answer comes from the memoized matrix
+        for (int32 i = 0; i < 2; ++i)
+        {
+            check(FSignatureRegistry::CheckInvokeable(IntId, IntId));
+            check(!FSignatureRegistry::CheckInvokeable(IntId, FloatId));
+            check(!FSignatureRegistry::CheckInvokeable(FloatId, IntId));
+            check(!FSignatureRegistry::CheckInvokeable(ObjectId, IntId));
+
+            // an observer of a base class accepts broadcasts of a derived class, not the other way around
+            check(FSignatureRegistry::CheckInvokeable(ObjectId, TestObjectId));
+            check(!FSignatureRegistry::CheckInvokeable(TestObjectId, ObjectId));
+        }
+    };
+
+    CheckVerdicts();
+
+    // a new epoch drops the matrix, the object types are found again and the verdicts don't change
+    const uint32 Epoch = FSignatureCompatibilityEpoch::Get();
+    FSignatureCompatibilityEpoch::Advance();
+    check(FSignatureCompatibilityEpoch::Get() != Epoch && FSignatureCompatibilityEpoch::Get() != 0);
+
+    CheckVerdicts();
+
+    // ids are stable across epochs
+    check(TGenericSignature<UObject*>::StaticSignature()->GetId() == ObjectId);
+    check(FSignatureRegistry::Intern(TGenericSignature<UTestObject*>::StaticSignature()->GetParameters(), NAME_None) == TestObjectId);
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestSlotEvent, int);
+
+void UGameEventTestsSubsystem::TestEventSlots()
+{
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    // a slot can be resolved before the event has a signal, broadcasting through it finds no observer
+    const FGlobalEventSlot Slot = EventCenter->ResolveEventSlot(FTestSlotEvent::GetEventName());
+    check(Slot.IsValid() && Slot.OwnerSerial != 0);
+    check(!EventCenter->Broadcast(Slot, 0));
+
+    // resolving the same event again gives the same slot
+    const FGlobalEventSlot SameSlot = EventCenter->ResolveEventSlot(FTestSlotEvent::GetEventName());
+    check(SameSlot.Index == Slot.Index && SameSlot.OwnerSerial == Slot.OwnerSerial);
+
+    int NumCalls = 0;
+
+    EventCenter->Register<FTestSlotEvent>([&NumCalls](int InValue)
+        {
+            check(InValue == 1);
+
+            ++NumCalls;
+        });
+
+    verify(EventCenter->Broadcast(Slot, 1));
+    check(NumCalls == 1);
+
+    // the slot stays valid when the signal of the event is cleared and created again
+    EventCenter->ClearEventObservers<FTestSlotEvent>();
+    check(!EventCenter->Broadcast(Slot, 1));
+
+    EventCenter->Register<FTestSlotEvent>([&NumCalls](int InValue)
+        {
+            ++NumCalls;
+        });
+
+    verify(EventCenter->Broadcast(Slot, 1));
+    check(NumCalls == 2);
+
+    // a slot of another event center has another serial, its index means nothing here and the name is looked up instead
+    const FGlobalEventSlot ForeignSlot(FTestSlotEvent::GetEventName(), EventCenter->ResolveEventSlot(TEXT("Test.Slot.Other")).Index, Slot.OwnerSerial + 1);
+
+    verify(EventCenter->Broadcast(ForeignSlot, 1));
+    check(NumCalls == 3);
+
+    // unresolved slots are looked up by name as well
+    verify(EventCenter->Broadcast(FGlobalEventSlot(FTestSlotEvent::GetEventName(), INDEX_NONE, 0), 1));
+    check(NumCalls == 4);
+
+    EventCenter->ClearEventObservers<FTestSlotEvent>();
+}
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestIdEvent, int);
+DEFINE_TYPESAFE_GLOBAL_EVENT(TestOtherIdEvent, int);
+
+void UGameEventTestsSubsystem::TestTypeSafeEventIds()
+{
+    using namespace UE::GlobalEvents::Details;
+
+    // ids are dense and assigned at module load, events with the same name reuse the id
+    const int32 NumEvents = FTypeSafeEventRegistry::Num();
+    check(FTestIdEvent::GetEventId() >= 0 && FTestIdEvent::GetEventId() < NumEvents);
+    check(FTestOtherIdEvent::GetEventId() >= 0 && FTestOtherIdEvent::GetEventId() < NumEvents);
+    check(FTestIdEvent::GetEventId() != FTestOtherIdEvent::GetEventId());
+    check(FTypeSafeEventRegistry::RegisterEvent(FTestIdEvent::GetEventName()) == FTestIdEvent::GetEventId());
+    check(FTypeSafeEventRegistry::Num() == NumEvents);
+
+    // a previous game instance may have registered it already
+    const int32 NewId = FTypeSafeEventRegistry::RegisterEvent(TEXT("Test.Id.Runtime"));
+    check(NewId >= 0 && NewId < FTypeSafeEventRegistry::Num() && FTypeSafeEventRegistry::Num() <= NumEvents + 1);
+    check(FTypeSafeEventRegistry::RegisterEvent(TEXT("Test.Id.Runtime")) == NewId);
+
+    UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(this);
+    check(EventCenter != nullptr);
+
+    // broadcasting without observers must not add a slot, slots are appended so the next one shows it
+    const FGlobalEventSlot FirstSlot = EventCenter->ResolveEventSlot(TEXT("Test.Id.First"));
+    check(!EventCenter->Broadcast<FTestIdEvent>(1));
+
+    const FGlobalEventSlot SecondSlot = EventCenter->ResolveEventSlot(TEXT("Test.Id.Second"));
+    check(SecondSlot.Index == FirstSlot.Index + 1);
+
+    int NumCalls = 0;
+
+    EventCenter->Register<FTestIdEvent>([&NumCalls](int InValue)
+        {
+            ++NumCalls;
+        });
+
+    verify(EventCenter->Broadcast<FTestIdEvent>(1));
+    check(NumCalls == 1);
+
+    // the slot of the event is reused when it is registered again
+    const FGlobalEventSlot EventSlot = EventCenter->ResolveEventSlot(FTestIdEvent::GetEventName());
+
+    EventCenter->ClearEventObservers<FTestIdEvent>();
+    check(!EventCenter->Broadcast<FTestIdEvent>(1));
+
+    EventCenter->Register<FTestIdEvent>([&NumCalls](int InValue)
+        {
+            ++NumCalls;
+        });
+
+    check(EventCenter->ResolveEventSlot(FTestIdEvent::GetEventName()).Index == EventSlot.Index);
+    verify(EventCenter->Broadcast<FTestIdEvent>(1));
+    check(NumCalls == 2);
+
+    EventCenter->ClearEventObservers<FTestIdEvent>();
+}
@@ -0,0 +1,517 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "UObject/UObjectArray.h"
+#include "GameEventSubsystem.h"
+
+/*
+* Micro benchmarks for the global event system.
+* Run console command "GlobalEvents.Benchmark" and check the GlobalEventsLog output.
+*/
+namespace GlobalEventsBenchmarks
+{
+    using namespace UE::GlobalEvents::Details;
+
+    static const int32 ObserverCounts[] = { 10, 100, 1000, 10000 };
+
+    // keep total invocations per measurement roughly constant
+    inline int32 GetIterations(int32 InObserverCount)
+    {
+        return FMath::Max(10, 2000000 / InObserverCount);
+    }
+
+    template <typename FunctorType>
+    double MeasureNanosecondsPerObserver(int32 InObserverCount, FunctorType&& InFunctor)
+    {
+        const int32 Iterations = GetIterations(InObserverCount);
+
+        // warm up
+        InFunctor();
+
+        const double StartTime = FPlatformTime::Seconds();
+
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            InFunctor();
+        }
+
+        return (FPlatformTime::Seconds() - StartTime) * 1e9 / ((double)Iterations * InObserverCount);
+    }
+
+    class FBenchmarkListener
+    {
+    public:
+        void OnEvent(int32 InValue)
+        {
+            Value += InValue;
+        }
+
+        int64 Value = 0;
+    };
+
+    typedef TMemberFunctionEventObserver<FBenchmarkListener, int32> FListenerObserverType;
+
+    /*
+    * Replicates the observer storage used before the slab: 
+    * every observer is a separated heap object behind a TSharedPtr, dispatch copies the TSharedPtr and goes through the vtable.
+    */
+    class FSharedPtrObserverList
+    {
+    public:
+        ~FSharedPtrObserverList()
+        {
+            Targets.Empty();
+        }
+
+        void Add(FBenchmarkListener* InListener)
+        {
+            FListenerObserverType Observer(InListener, &FBenchmarkListener::OnEvent);
+
+            IEventObserver* Instance = Observer.CloneAndMove(FMemory::Malloc(Observer.GetObjectSize(), Observer.GetObjectAlignment()));
+
+            Targets.Add(TSharedPtr<IEventObserver>(Instance, [](IEventObserver* InInstance)
+                {
+                    InInstance->~IEventObserver();
+                    FMemory::Free(InInstance);
+                }));
+        }
+
+        void RaiseEvent(int32 InValue)
+        {
+            for (int32 i = 0; i < Targets.Num(); ++i)
+            {
+                auto Instance = Targets[i];
+
+                // the pending destroy check was one more virtual call here, so this baseline is slightly optimistic
+                if (Instance->IsGeneric())
+                {
+                    ((TBaseEventObserver<int32>*)Instance.Get())->Invoke(InValue);
+                }
+            }
+        }
+
+    private:
+        TArray<TSharedPtr<IEventObserver>>  Targets;
+    };
+
+    static void RunSlabBenchmark()
+    {
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Observer Storage] ns per observer call, SharedPtr list vs Slab signal"));
+
+        for (const int32 ObserverCount : ObserverCounts)
+        {
+            TArray<FBenchmarkListener> Listeners;
+            Listeners.SetNum(ObserverCount);
+
+            FSharedPtrObserverList SharedPtrList;
+            TSignal<int32> Signal;
+
+            for (FBenchmarkListener& Listener : Listeners)
+            {
+                SharedPtrList.Add(&Listener);
+
+                FListenerObserverType Observer(&Listener, &FBenchmarkListener::OnEvent);
+                Signal.Connect(&Observer);
+            }
+
+            const double SharedPtrTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { SharedPtrList.RaiseEvent(1); });
+            const double SlabTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { Signal.RaiseEvent(1); });
+
+            UE_LOG(GlobalEventsLog, Display, TEXT("  Observers=%6d  SharedPtr=%8.3f  Slab=%8.3f  Speedup=%.2fx"),
+                ObserverCount,
+                SharedPtrTime,
+                SlabTime,
+                SharedPtrTime / FMath::Max(SlabTime, 0.001)
+            );
+        }
+    }
+
+    DECLARE_MULTICAST_DELEGATE_OneParam(FBenchmarkMulticastDelegate, int32);
+
+    static void RunDelegateBenchmark()
+    {
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Dispatch] ns per observer call, TMulticastDelegate vs TSignal"));
+
+        for (const int32 ObserverCount : ObserverCounts)
+        {
+            TArray<FBenchmarkListener> Listeners;
+            Listeners.SetNum(ObserverCount);
+
+            FBenchmarkMulticastDelegate Delegate;
+            TSignal<int32> Signal;
+
+            for (FBenchmarkListener& Listener : Listeners)
+            {
+                Delegate.AddRaw(&Listener, &FBenchmarkListener::OnEvent);
+
+                FListenerObserverType Observer(&Listener, &FBenchmarkListener::OnEvent);
+                Signal.Connect(&Observer);
+            }
+
+            const double DelegateTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { Delegate.Broadcast(1); });
+            const double SignalTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { Signal.RaiseEvent(1); });
+
+            UE_LOG(GlobalEventsLog, Display, TEXT("  Observers=%6d  Delegate=%8.3f  Signal=%8.3f  Speedup=%.2fx"),
+                ObserverCount,
+                DelegateTime,
+                SignalTime,
+                DelegateTime / FMath::Max(SignalTime, 0.001)
+            );
+        }
+    }
+
+    static void RunUnregisterBenchmark()
+    {
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Unregister] ns per observer, disconnect every observer by handle"));
+
+        for (const int32 ObserverCount : ObserverCounts)
+        {
+            TArray<FBenchmarkListener> Listeners;
+            Listeners.SetNum(ObserverCount);
+
+            TArray<FDelegateHandle> Handles;
+            Handles.Reserve(ObserverCount);
+
+            double TotalSeconds = 0.0;
+            const int32 Iterations = FMath::Max(1, GetIterations(ObserverCount) / 100);
+
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                TSignal<int32> Signal;
+                Handles.Reset();
+
+                for (FBenchmarkListener& Listener : Listeners)
+                {
+                    FListenerObserverType Observer(&Listener, &FBenchmarkListener::OnEvent);
+                    Handles.Add(Signal.Connect(&Observer));
+                }
+
+                const double StartTime = FPlatformTime::Seconds();
+
+                for (const FDelegateHandle& Handle : Handles)
+                {
+                    Signal.Disconnect(Handle);
+                }
+
+                TotalSeconds += FPlatformTime::Seconds() - StartTime;
+
+                check(Signal.IsEmpty());
+            }
+
+            UE_LOG(GlobalEventsLog, Display, TEXT("  Observers=%6d  Disconnect=%8.3f"),
+                ObserverCount,
+                TotalSeconds * 1e9 / ((double)Iterations * ObserverCount)
+            );
+        }
+    }
+
+    // a pure consumer with a little work, like an analytics counter or a spatial grid update
+    class FParallelBenchmarkListener
+    {
+    public:
+        void OnEvent(int32 InValue)
+        {
+            uint32 Hash = Value;
+
+            for (int32 i = 0; i < 32; ++i)
+            {
+                Hash = HashCombine(Hash, (uint32)(InValue + i));
+            }
+
+            Value = Hash;
+        }
+
+        uint32 Value = 0;
+    };
+
+    typedef TMemberFunctionEventObserver<FParallelBenchmarkListener, int32> FParallelListenerObserverType;
+
+    // one batch is called by one thread, so the number of batches bounds the number of threads a broadcast uses
+    static void RunParallelScalingBenchmark()
+    {
+        IConsoleVariable* BatchSizeVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("GlobalEvents.ParallelDispatchBatchSize"));
+        check(BatchSizeVariable != nullptr);
+
+        const int32 MaxThreads = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+        constexpr int32 ObserverCount = 16384;
+
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Parallel Scaling] ns per observer call of %d concurrent-safe observers, by number of threads"), ObserverCount);
+
+        TArray<FParallelBenchmarkListener> Listeners;
+        Listeners.SetNum(ObserverCount);
+
+        TSignal<int32> SerialSignal;
+        TSignal<int32> ParallelSignal;
+
+        for (FParallelBenchmarkListener& Listener : Listeners)
+        {
+            FParallelListenerObserverType Observer(&Listener, &FParallelBenchmarkListener::OnEvent);
+            SerialSignal.Connect(&Observer);
+            ParallelSignal.Connect(&Observer, FGlobalEventObserverOptions::ConcurrentSafe());
+        }
+
+        const double SerialTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { SerialSignal.RaiseEvent(1); });
+        const int32 SavedBatchSize = BatchSizeVariable->GetInt();
+
+        for (int32 NumThreads = 2; NumThreads <= 32; NumThreads *= 2)
+        {
+            if (NumThreads > MaxThreads)
+            {
+                UE_LOG(GlobalEventsLog, Display, TEXT("  Threads=%2d  skipped, only %d threads available"), NumThreads, MaxThreads);
+                continue;
+            }
+
+            BatchSizeVariable->Set(FMath::DivideAndRoundUp(ObserverCount, NumThreads));
+
+            const double ParallelTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { ParallelSignal.RaiseEvent(1); });
+
+            UE_LOG(GlobalEventsLog, Display, TEXT("  Threads=%2d  Serial=%8.3f  Parallel=%8.3f  Speedup=%.2fx"),
+                NumThreads,
+                SerialTime,
+                ParallelTime,
+                SerialTime / FMath::Max(ParallelTime, 0.001)
+            );
+        }
+
+        BatchSizeVariable->Set(SavedBatchSize);
+    }
+
+    static void RunParallelDispatchBenchmark()
+    {
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Parallel Dispatch] ns per observer call, serial vs concurrent-safe observers, %d task graph workers"),
+            FTaskGraphInterface::Get().GetNumWorkerThreads()
+        );
+
+        // below GlobalEvents.ParallelDispatchThreshold concurrent-safe observers are dispatched serially as well
+        static const int32 ParallelObserverCounts[] = { 1000, 4000, 10000 };
+
+        for (const int32 ObserverCount : ParallelObserverCounts)
+        {
+            TArray<FParallelBenchmarkListener> Listeners;
+            Listeners.SetNum(ObserverCount);
+
+            TSignal<int32> SerialSignal;
+            TSignal<int32> ParallelSignal;
+
+            for (FParallelBenchmarkListener& Listener : Listeners)
+            {
+                FParallelListenerObserverType Observer(&Listener, &FParallelBenchmarkListener::OnEvent);
+                SerialSignal.Connect(&Observer);
+                ParallelSignal.Connect(&Observer, FGlobalEventObserverOptions::ConcurrentSafe());
+            }
+
+            const double SerialTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { SerialSignal.RaiseEvent(1); });
+            const double ParallelTime = MeasureNanosecondsPerObserver(ObserverCount, [&]() { ParallelSignal.RaiseEvent(1); });
+
+            UE_LOG(GlobalEventsLog, Display, TEXT("  Observers=%6d  Serial=%8.3f  Parallel=%8.3f  Speedup=%.2fx"),
+                ObserverCount,
+                SerialTime,
+                ParallelTime,
+                SerialTime / FMath::Max(ParallelTime, 0.001)
+            );
+        }
+
+        RunParallelScalingBenchmark();
+    }
+
+    class FContainerBenchmarkListener
+    {
+    public:
+        void OnEventByReference(const TArray<FString>& InStrings, const TMap<int32, UObject*>& InObjects)
+        {
+            Value += InStrings.Num() + InObjects.Num();
+        }
+
+        void OnEventByValue(TArray<FString> InStrings, TMap<int32, UObject*> InObjects)
+        {
+            Value += InStrings.Num() + InObjects.Num();
+        }
+
+        int64 Value = 0;
+    };
+
+    DECLARE_MULTICAST_DELEGATE_TwoParams(FContainerBenchmarkDelegate, const TArray<FString>&, const TMap<int32, UObject*>&);
+
+    static void RunContainerPayloadBenchmark()
+    {
+        constexpr int32 NumElements = 1000;
+        constexpr int32 Iterations = 1000;
+
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Container Payloads] us per broadcast of (TArray<FString>, TMap<int32, UObject*>) with %d elements each"), NumElements);
+
+        TArray<FString> Strings;
+        TMap<int32, UObject*> Objects;
+
+        for (int32 i = 0; i < NumElements; ++i)
+        {
+            Strings.Add(FString::Printf(TEXT("Element_%d"), i));
+            Objects.Add(i, nullptr);
+        }
+
+        // the cost the dispatch used to pay for every layer that passed the parameters by value
+        double StartTime = FPlatformTime::Seconds();
+
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            TArray<FString> StringsCopy = Strings;
+            TMap<int32, UObject*> ObjectsCopy = Objects;
+        }
+
+        UE_LOG(GlobalEventsLog, Display, TEXT("  One payload copy=%8.3f"), (FPlatformTime::Seconds() - StartTime) * 1e6 / Iterations);
+
+        static const int32 ContainerObserverCounts[] = { 1, 4, 16 };
+
+        for (const int32 ObserverCount : ContainerObserverCounts)
+        {
+            TArray<FContainerBenchmarkListener> Listeners;
+            Listeners.SetNum(ObserverCount);
+
+            FContainerBenchmarkDelegate Delegate;
+            TSignal<TArray<FString>, TMap<int32, UObject*>> ReferenceSignal;
+            TSignal<TArray<FString>, TMap<int32, UObject*>> ValueSignal;
+
+            for (FContainerBenchmarkListener& Listener : Listeners)
+            {
+                Delegate.AddRaw(&Listener, &FContainerBenchmarkListener::OnEventByReference);
+
+                TMemberFunctionEventObserver<FContainerBenchmarkListener, const TArray<FString>&, const TMap<int32, UObject*>&> ReferenceObserver(&Listener, &FContainerBenchmarkListener::OnEventByReference);
+                ReferenceSignal.Connect(&ReferenceObserver);
+
+                TMemberFunctionEventObserver<FContainerBenchmarkListener, TArray<FString>, TMap<int32, UObject*>> ValueObserver(&Listener, &FContainerBenchmarkListener::OnEventByValue);
+                ValueSignal.Connect(&ValueObserver);
+            }
+
+            auto Measure = [&](auto&& InBroadcast)
+            {
+                InBroadcast();
+
+                const double MeasureStartTime = FPlatformTime::Seconds();
+
+                for (int32 i = 0; i < Iterations; ++i)
+                {
+                    InBroadcast();
+                }
+
+                return (FPlatformTime::Seconds() - MeasureStartTime) * 1e6 / Iterations;
+            };
+
+            const double DelegateTime = Measure([&]() { Delegate.Broadcast(Strings, Objects); });
+            const double ReferenceTime = Measure([&]() { ReferenceSignal.RaiseEvent(Strings, Objects); });
+            const double ValueTime = Measure([&]() { ValueSignal.RaiseEvent(Strings, Objects); });
+
+            // the caller builds a payload for each broadcast and gives it away, the last observer takes it instead of a copy
+            const double MovedTime = Measure([&]()
+                {
+                    TArray<FString> StringsCopy = Strings;
+                    TMap<int32, UObject*> ObjectsCopy = Objects;
+
+                    ValueSignal.RaiseEvent(EEventParamOwnership::Owned, StringsCopy, ObjectsCopy);
+                });
+
+            // only observers taking a value copy the payload
+            UE_LOG(GlobalEventsLog, Display, TEXT("  Observers=%3d  Delegate=%8.3f  Signal(by reference)=%8.3f  Signal(by value)=%8.3f  Signal(by value, built and moved)=%8.3f"),
+                ObserverCount,
+                DelegateTime,
+                ReferenceTime,
+                ValueTime,
+                MovedTime
+            );
+        }
+    }
+
+    static void RunContextPoolBenchmark()
+    {
+        constexpr int32 Iterations = 10000;
+
+        typedef TDynamicEventContextFactory<int32, FString, FVector> FContextFactory;
+
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Dynamic Contexts] %d contexts of (int32, FString, FVector), NewObject vs FDynamicEventContextPool"), Iterations);
+
+        const FString Payload = TEXT("Payload");
+
+        int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+        double StartTime = FPlatformTime::Seconds();
+
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            FContextFactory::NewContext(i, Payload, FVector::ZeroVector);
+        }
+
+        const double NewObjectTime = (FPlatformTime::Seconds() - StartTime) * 1e9 / Iterations;
+        const int32 NewObjectGarbage = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+
+        UE::GlobalEvents::FDynamicEventContextPool Pool;
+
+        ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+        StartTime = FPlatformTime::Seconds();
+
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            UDynamicEventContext* Context = Pool.Acquire();
+            FContextFactory::Fill(Context, i, Payload, FVector::ZeroVector);
+            Pool.Release(Context);
+        }
+
+        const double PooledTime = (FPlatformTime::Seconds() - StartTime) * 1e9 / Iterations;
+        const int32 PooledObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+
+        UE_LOG(GlobalEventsLog, Display, TEXT("  NewObject=%8.1f ns, %d objects for the GC"), NewObjectTime, NewObjectGarbage);
+        UE_LOG(GlobalEventsLog, Display, TEXT("  Pooled   =%8.1f ns, %d objects kept by the pool"), PooledTime, PooledObjects);
+    }
+
+    static void RunMemoryReport()
+    {
+        constexpr int32 ObserverCount = 10000;
+
+        TArray<FBenchmarkListener> Listeners;
+        Listeners.SetNum(ObserverCount);
+
+        TSignal<int32> Signal;
+
+        for (FBenchmarkListener& Listener : Listeners)
+        {
+            FListenerObserverType Observer(&Listener, &FBenchmarkListener::OnEvent);
+            Signal.Connect(&Observer);
+        }
+
+        // observers used to embed a TGenericSignature, build as many as the observers had and measure what they allocate
+        TArray<TGenericSignature<int32>> EmbeddedSignatures;
+        EmbeddedSignatures.SetNum(ObserverCount);
+
+        SIZE_T EmbeddedSignaturesSize = EmbeddedSignatures.GetAllocatedSize();
+
+        for (const TGenericSignature<int32>& EmbeddedSignature : EmbeddedSignatures)
+        {
+            EmbeddedSignaturesSize += EmbeddedSignature.GetParameters().GetAllocatedSize();
+        }
+
+        UE_LOG(GlobalEventsLog, Display, TEXT("[Memory] %d observers"), ObserverCount);
+        UE_LOG(GlobalEventsLog, Display, TEXT("  Observer object=%d bytes, embedded signature was %d bytes more"),
+            (int32)sizeof(FListenerObserverType),
+            (int32)(EmbeddedSignaturesSize / ObserverCount)
+        );
+        UE_LOG(GlobalEventsLog, Display, TEXT("  Signal=%.1f KB, the embedded signatures of as many observers allocate %.1f KB"),
+            Signal.GetAllocatedSize() / 1024.0,
+            EmbeddedSignaturesSize / 1024.0
+        );
+    }
+
+    static void RunBenchmarks()
+    {
+        RunSlabBenchmark();
+        RunDelegateBenchmark();
+        RunUnregisterBenchmark();
+        RunParallelDispatchBenchmark();
+        RunContainerPayloadBenchmark();
+        RunContextPoolBenchmark();
+        RunMemoryReport();
+    }
+
+    static FAutoConsoleCommand GBenchmarkCommand(
+        TEXT("GlobalEvents.Benchmark"),
+        TEXT("Run global events benchmarks, results are printed to the GlobalEventsLog."),
+        FConsoleCommandDelegate::CreateStatic(&RunBenchmarks)
+    );
+}
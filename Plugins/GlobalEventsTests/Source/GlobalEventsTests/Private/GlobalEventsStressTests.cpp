@@ -0,0 +1,162 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "GameEventSubsystem.h"
+#include <atomic>
+
+DEFINE_TYPESAFE_GLOBAL_EVENT(ConcurrencyStressEvent, int32);
+
+/*
+* Stress test of the concurrent mode of UGameEventSubsystem.
+* Start the game with GlobalEvents.ConcurrentMode 1, run console command "GlobalEvents.ConcurrencyStress [Seconds]" and check the GlobalEventsLog output.
+* Reader threads broadcast while writer threads register, unregister and clear observers of the same events.
+*/
+namespace GlobalEventsStressTests
+{
+    using namespace UE::GlobalEvents::Details;
+
+    static const FName ChurnEventName(TEXT("GlobalEvents.ConcurrencyStress.Churn"));
+
+    static std::atomic<int64> GNumChurnCalls{ 0 };
+
+    static void OnChurnEvent(int32)
+    {
+        GNumChurnCalls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void RunConcurrencyStress(const TArray<FString>& InArgs, UWorld* InWorld)
+    {
+        const double Seconds = InArgs.Num() > 0 ? FCString::Atod(*InArgs[0]) : 5.0;
+        constexpr int32 NumReaders = 8;
+        constexpr int32 NumWriters = 4;
+        constexpr int32 ObserversPerWrite = 16;
+
+        // the subsystem of the game instance went through Initialize, so it runs exactly like in the game
+        UGameEventSubsystem* EventCenter = UGameEventSubsystem::GetInstance(InWorld);
+
+        if (EventCenter == nullptr || !EventCenter->IsConcurrentMode())
+        {
+            UE_LOG(GlobalEventsLog, Warning, TEXT("[ConcurrencyStress] needs a game instance started with GlobalEvents.ConcurrentMode 1."));
+
+            return;
+        }
+
+        GNumChurnCalls.store(0);
+
+        std::atomic<bool> bStop{ false };
+        std::atomic<int64> NumBroadcasts{ 0 };
+        std::atomic<int64> NumPersistentCalls{ 0 };
+        std::atomic<int64> NumWrites{ 0 };
+
+        // never removed, so it must see every broadcast of the stress event
+        const FDelegateHandle PersistentHandle = EventCenter->Register<FConcurrencyStressEvent>([&NumPersistentCalls](int32) { NumPersistentCalls.fetch_add(1, std::memory_order_relaxed); });
+
+        const FGlobalEventSlot Slot = EventCenter->ResolveEventSlot(FConcurrencyStressEvent::GetEventName());
+
+        TArray<TFuture<void>> Workers;
+
+        for (int32 i = 0; i < NumReaders; ++i)
+        {
+            Workers.Add(Async(EAsyncExecution::Thread, [&, i]()
+                {
+                    int32 Iteration = 0;
+
+                    while (!bStop.load(std::memory_order_relaxed))
+                    {
+                        // cover the type-safe, slot and name lookups
+                        switch ((Iteration++ + i) % 3)
+                        {
+                        case 0:
+                            verify(EventCenter->Broadcast<FConcurrencyStressEvent>(1));
+                            break;
+                        case 1:
+                            verify(EventCenter->Broadcast(Slot, 1));
+                            break;
+                        default:
+                            verify(EventCenter->Broadcast(FConcurrencyStressEvent::GetEventName(), 1));
+                            break;
+                        }
+
+                        NumBroadcasts.fetch_add(1, std::memory_order_relaxed);
+
+                        // the churn event comes and goes, so the result is not checked
+                        EventCenter->Broadcast(ChurnEventName, 1);
+                    }
+                }));
+        }
+
+        for (int32 i = 0; i < NumWriters; ++i)
+        {
+            Workers.Add(Async(EAsyncExecution::Thread, [&, i]()
+                {
+                    TArray<FDelegateHandle> Handles;
+                    int32 Iteration = 0;
+
+                    while (!bStop.load(std::memory_order_relaxed))
+                    {
+                        Handles.Reset();
+
+                        for (int32 j = 0; j < ObserversPerWrite; ++j)
+                        {
+                            // functors have no identity, so they are never rejected as duplicates
+                            Handles.Add(EventCenter->Register<FConcurrencyStressEvent>([](int32 InValue) { OnChurnEvent(InValue); }));
+                            check(Handles.Last().IsValid());
+                        }
+
+                        for (const FDelegateHandle& Handle : Handles)
+                        {
+                            verify(EventCenter->UnRegister(Slot, Handle));
+                        }
+
+                        // replace the whole signal of the churn event from time to time
+                        if ((Iteration++ + i) % 8 == 0)
+                        {
+                            EventCenter->ClearEventObservers(ChurnEventName);
+                        }
+                        else
+                        {
+                            // duplicates are rejected, so only one writer at a time adds it
+                            EventCenter->Register(ChurnEventName, &OnChurnEvent);
+                        }
+
+                        NumWrites.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }));
+        }
+
+        FPlatformProcess::Sleep((float)Seconds);
+        bStop.store(true);
+
+        for (TFuture<void>& Worker : Workers)
+        {
+            Worker.Wait();
+        }
+
+        check(NumPersistentCalls.load() == NumBroadcasts.load());
+
+        // the subsystem outlives the test, leave none of its observers behind
+        verify(EventCenter->UnRegister(Slot, PersistentHandle));
+        EventCenter->ClearEventObservers(ChurnEventName);
+
+        FReadCopyUpdate::Synchronize();
+        check(FReadCopyUpdate::GetNumRetired() == 0);
+
+        UE_LOG(GlobalEventsLog, Display, TEXT("[ConcurrencyStress] %.1fs, readers=%d writers=%d broadcasts=%lld churn calls=%lld writes=%lld"),
+            Seconds,
+            NumReaders,
+            NumWriters,
+            NumBroadcasts.load(),
+            GNumChurnCalls.load(),
+            NumWrites.load()
+        );
+    }
+
+    static FAutoConsoleCommand GConcurrencyStressCommand(
+        TEXT("GlobalEvents.ConcurrencyStress"),
+        TEXT("Broadcast, register and unregister global events from many threads in concurrent mode, results are printed to the GlobalEventsLog."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunConcurrencyStress)
+    );
+}
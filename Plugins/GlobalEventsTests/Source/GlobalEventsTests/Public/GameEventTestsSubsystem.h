@@ -27,7 +27,24 @@ private:
 	void UnRegisterDebugEvent();
 	void SendDebugEvent();
 	void TestDynamicTuple();
+	void TestDynamicTupleAlignment();
 	void TestReferenceParameter();
+	void TestReentrantBroadcast();
+	void TestQueuedEvents();
+	void TestEventQueueArena();
+	void TestConcurrentQueuedEvents();
+	void TestParallelDispatch();
+	void TestThreadAffinity();
+	void TestDynamicThreadAffinity();
+	void TestCoalescedEvents();
+	void TestDeferredEvents();
+	void TestContextPool();
+	void TestHasListeners();
+	void TestForwardedParameters();
+	void TestMovedParameters();
+	void TestSignatureRegistry();
+	void TestEventSlots();
+	void TestTypeSafeEventIds();
 
 private:
 	FRawTestsObject RawObj;
@@ -13,6 +13,16 @@
 #define FUNC_NAME    *FString(__FUNCTION__)
 #endif
 
+// aligned beyond FDynamicTuple::InlineAlignment, so a tuple holding it needs an over-aligned heap buffer
+USTRUCT()
+struct alignas(32) FTestOverAlignedStruct
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Value = 0;
+};
+
 /**
  * 
  */